@@ -0,0 +1,263 @@
+#include "Alphabet.h"
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <algorithm>
+
+// ================================================================================================================================ //
+
+// The number of letters in the English Alphabet.
+static constexpr std::size_t english_letters{ 26 };
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Appends the code point to the text as UTF-8.
+static void append_utf8(const char32_t code_point, std::string& text)
+{
+	if (code_point < 0x80)
+	{
+		text.push_back(char(code_point));
+	}
+	else if (code_point < 0x800)
+	{
+		text.push_back(char(0xC0 | (code_point >> 6)));
+		text.push_back(char(0x80 | (code_point & 0x3F)));
+	}
+	else if (code_point < 0x10000)
+	{
+		text.push_back(char(0xE0 | (code_point >> 12)));
+		text.push_back(char(0x80 | ((code_point >> 6) & 0x3F)));
+		text.push_back(char(0x80 | (code_point & 0x3F)));
+	}
+	else
+	{
+		text.push_back(char(0xF0 | (code_point >> 18)));
+		text.push_back(char(0x80 | ((code_point >> 12) & 0x3F)));
+		text.push_back(char(0x80 | ((code_point >> 6) & 0x3F)));
+		text.push_back(char(0x80 | (code_point & 0x3F)));
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the number of bytes in the UTF-8 sequence that starts with the given byte (or 0 if no sequence starts with it).
+static std::size_t sequence_length(const unsigned char lead) noexcept
+{
+	if (lead < 0x80)
+		return 1;
+	if ((lead & 0xE0) == 0xC0)
+		return 2;
+	if ((lead & 0xF0) == 0xE0)
+		return 3;
+	if ((lead & 0xF8) == 0xF0)
+		return 4;
+	return 0;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the lowercase form of an uppercase letter of the Latin-1, Latin Extended-A, Greek or Cyrillic blocks (or else the letter itself).
+static char32_t fold_case(const char32_t letter) noexcept
+{
+	// Latin-1 (À to Þ, but not ×).
+	if (letter >= 0xC0 && letter <= 0xDE && letter != 0xD7)
+		return letter + 0x20;
+
+	// Latin Extended-A, where most of the block pairs an uppercase letter with the lowercase letter after it.
+	if ((letter >= 0x100 && letter <= 0x12F) || (letter >= 0x132 && letter <= 0x137) || (letter >= 0x14A && letter <= 0x177))
+		return letter | 1;
+	if ((letter >= 0x139 && letter <= 0x148) || (letter >= 0x179 && letter <= 0x17E))
+		return (letter % 2 == 1) ? letter + 1 : letter;
+	if (letter == 0x178)
+		return 0xFF;
+
+	// Greek (Α to Ω) and Cyrillic (Ѐ to Я).
+	if (letter >= 0x391 && letter <= 0x3A9 && letter != 0x3A2)
+		return letter + 0x20;
+	if (letter >= 0x410 && letter <= 0x42F)
+		return letter + 0x20;
+	if (letter >= 0x400 && letter <= 0x40F)
+		return letter + 0x50;
+
+	return letter;
+}
+
+// ================================================================================================================================ //
+
+Alphabet::Alphabet(std::vector<char32_t> extra_letters)
+	:
+	extra{ std::move(extra_letters) }, letters{}
+{
+	std::sort(extra.begin(), extra.end());
+	extra.erase(std::unique(extra.begin(), extra.end()), extra.end());
+
+	if (english_letters + extra.size() > max_letters)
+		throw std::runtime_error("Alphabet has too many letters.");
+
+	letters.reserve(english_letters + extra.size());
+	for (char letter{ 'a' }; letter <= 'z'; ++letter)
+		letters.emplace_back(1, letter);
+
+	for (const char32_t letter : extra)
+	{
+		if (letter < 0x80)
+			throw std::runtime_error("Alphabet was given an ASCII letter.");
+
+		std::string text{};
+		append_utf8(letter, text);
+		letters.push_back(std::move(text));
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+const std::shared_ptr<const Alphabet>& Alphabet::english()
+{
+	static const std::shared_ptr<const Alphabet> alphabet{ std::make_shared<const Alphabet>() };
+	return alphabet;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::shared_ptr<const Alphabet> Alphabet::shared(std::vector<char32_t> extra_letters)
+{
+	std::sort(extra_letters.begin(), extra_letters.end());
+	extra_letters.erase(std::unique(extra_letters.begin(), extra_letters.end()), extra_letters.end());
+
+	if (extra_letters.empty())
+		return english();
+
+	// The registry only holds weak references, so an Alphabet is freed with the last Dictionary that uses it.
+	static std::mutex mutex{};
+	static std::map<std::vector<char32_t>, std::weak_ptr<const Alphabet>> registry{};
+
+	const std::lock_guard lock{ mutex };
+	std::weak_ptr<const Alphabet>& entry{ registry[extra_letters] };
+
+	std::shared_ptr<const Alphabet> alphabet{ entry.lock() };
+	if (!alphabet)
+	{
+		alphabet = std::make_shared<const Alphabet>(extra_letters);
+		entry = alphabet;
+	}
+	return alphabet;
+}
+
+// ================================================================================================================================ //
+
+bool Alphabet::encode(std::string_view text, std::string& word) const
+{
+	word.clear();
+	while (!text.empty())
+	{
+		const char32_t letter{ read_letter(text) };
+		if (letter == 0)
+			return false;
+
+		if (letter < 0x80)
+		{
+			word.push_back(char(letter));
+			continue;
+		}
+
+		const auto found{ std::lower_bound(extra.begin(), extra.end(), letter) };
+		if (found == extra.end() || *found != letter)
+			return false;
+
+		word.push_back(letter_code(english_letters + std::size_t(found - extra.begin())));
+	}
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::string Alphabet::encode(const std::string_view text) const
+{
+	std::string word{};
+	if (!encode(text, word))
+		throw std::runtime_error("Word has a letter that is not in the Alphabet.");
+
+	return word;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void Alphabet::decode(const std::string_view word, std::string& text) const
+{
+	for (const char code : word)
+		text.append(letters[letter_index(code)]);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::string Alphabet::decode(const std::string_view word) const
+{
+	std::string text{};
+	text.reserve(word.size());
+	decode(word, text);
+	return text;
+}
+
+// ================================================================================================================================ //
+
+char32_t read_letter(std::string_view& text) noexcept
+{
+	if (text.empty())
+		return 0;
+
+	const auto lead{ static_cast<unsigned char>(text[0]) };
+	if (lead < 0x80)
+	{
+		if (!((lead >= 'a' && lead <= 'z') || (lead >= 'A' && lead <= 'Z')))
+			return 0;
+
+		text.remove_prefix(1);
+		return char32_t(lead | 0x20);
+	}
+
+	const std::size_t length{ sequence_length(lead) };
+	if (length == 0)
+		return 0;
+
+	if (text.size() < length)
+		return 0;
+
+	// The first byte holds the highest bits of the code point (after the bits that give the length).
+	char32_t code_point{ char32_t(lead & (0x7F >> length)) };
+	for (std::size_t i{ 1 }; i < length; ++i)
+	{
+		const auto byte{ static_cast<unsigned char>(text[i]) };
+		if ((byte & 0xC0) != 0x80)
+			return 0;
+
+		code_point = (code_point << 6) | (byte & 0x3F);
+	}
+
+	// Overlong sequences, surrogates and code points past Unicode are not valid UTF-8.
+	constexpr char32_t shortest[]{ 0, 0, 0x80, 0x800, 0x10000 };
+	if (code_point < shortest[length] || (code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF)
+		return 0;
+
+	if (code_point < 0xC0 || code_point == 0xD7 || code_point == 0xF7)
+		return 0;
+
+	text.remove_prefix(length);
+	return fold_case(code_point);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t utf8_size(const char* const text, const std::size_t count) noexcept
+{
+	std::size_t size{};
+	for (std::size_t i{}; i < count; ++i)
+	{
+		// An invalid first byte is counted as a character of its own (reading it as a letter fails later).
+		const std::size_t length{ sequence_length(static_cast<unsigned char>(text[size])) };
+		size += (length != 0) ? length : 1;
+	}
+	return size;
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <string_view>
+
+#include "LetterSet.h"
+
+// ================================================================================================================================ //
+
+// The most letters that an Alphabet can have (letter i is stored as the byte 'a' + i, so the codes run from 'a' to 0xFF).
+inline constexpr std::size_t max_letters{ 256 - 'a' };
+
+static_assert(max_letters <= LetterSet::capacity, "A LetterSet must be able to hold every letter.");
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the index of the letter that is stored as the given code (a byte below 'a' gives an index past max_letters).
+inline std::size_t letter_index(const char code) noexcept
+{
+	return std::size_t(static_cast<unsigned char>(code)) - std::size_t{ 'a' };
+}
+
+// Returns the code that the letter with the given index is stored as.
+inline char letter_code(const std::size_t index) noexcept
+{
+	return static_cast<char>(static_cast<unsigned char>('a' + index));
+}
+
+// ================================================================================================================================ //
+
+/*
+	The letters that the words of a Dictionary are made of, and how they are stored.
+
+	Every letter is stored as a single byte (its code, 'a' + its index), so a word is still a std::string_view with one char per letter
+	whatever its language, and letter indices are dense (letter sets and counts only need as many entries as the alphabet has letters).
+	The 26 letters of English always come first, so English words are stored as themselves. They are followed by the other letters
+	that the words use, in the order of their code points.
+
+	Letters are read from UTF-8 text (ignoring case), and words are written back as UTF-8 when they are shown.
+	An Alphabet is built when a Dictionary is loaded, and is shared by every copy of it. Alphabets are interned (see shared()), so that
+	Dictionaries with the same letters share the same Alphabet, and words can only be compared if their Dictionaries do.
+*/
+class Alphabet
+{
+private: // Variables
+
+	// The letters that come after the English letters, as (lowercase) code points in increasing order.
+	std::vector<char32_t> extra;
+
+	// [Index] -> The letter as UTF-8 text.
+	std::vector<std::string> letters;
+
+public: // Functions
+
+	// Constructs the English Alphabet, followed by the given letters (lowercase code points past ASCII, in any order).
+	explicit Alphabet(std::vector<char32_t> extra_letters = {});
+
+	// Returns the English Alphabet (which every English Dictionary shares).
+	static const std::shared_ptr<const Alphabet>& english();
+
+	// Returns the Alphabet of the English letters and the given letters, which is the same object for the same letters while it is in use.
+	static std::shared_ptr<const Alphabet> shared(std::vector<char32_t> extra_letters);
+
+
+	// Returns the number of letters.
+	inline std::size_t size() const noexcept
+	{
+		return letters.size();
+	}
+
+	// Returns true if every letter fits in a LetterMask (so the fast path can be used).
+	inline bool fits_mask() const noexcept
+	{
+		return size() <= LetterMask::capacity;
+	}
+
+	// Returns true if the given code is the code of a letter of the Alphabet.
+	inline bool contains(const char code) const noexcept
+	{
+		return letter_index(code) < size();
+	}
+
+	// Returns the letter with the given index as UTF-8 text.
+	inline const std::string& letter(const std::size_t index) const noexcept
+	{
+		return letters[index];
+	}
+
+
+	// Replaces the word with the UTF-8 text in the codes of its letters (it only allocates if the word is too small to hold them).
+	// Returns false if the text has a character that is not a letter of the Alphabet.
+	bool encode(std::string_view text, std::string& word) const;
+
+	// Returns the UTF-8 text in the codes of its letters (throws if it has a character that is not a letter of the Alphabet).
+	std::string encode(const std::string_view text) const;
+
+	// Appends the word (in the codes of its letters) to the text as UTF-8.
+	void decode(const std::string_view word, std::string& text) const;
+
+	// Returns the word (in the codes of its letters) as UTF-8 text.
+	std::string decode(const std::string_view word) const;
+
+};
+
+// ================================================================================================================================ //
+
+// Reads the letter at the start of the UTF-8 text, and removes it from the text. Returns the letter as a lowercase code point,
+// or 0 (leaving the text as it is) if the text does not start with a letter: an ASCII letter, or any code point from U+00C0 on
+// (except for × and ÷, as telling letters apart from symbols past that would take the Unicode tables).
+char32_t read_letter(std::string_view& text) noexcept;
+
+// Returns the number of bytes that the first count characters of the UTF-8 text take up (judging only by their first bytes).
+std::size_t utf8_size(const char* const text, const std::size_t count) noexcept;
+
+// ================================================================================================================================ //
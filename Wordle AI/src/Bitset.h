@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+#include <bitset>
+#include <memory_resource>
+
+// ================================================================================================================================ //
+
+/*
+	A fixed-size set of bits, stored as 64-bit blocks.
+	Used to represent sets of words by their index in a Dictionary.
+
+	The blocks can be placed in any memory resource (copies are always made in the default one).
+*/
+class Bitset
+{
+public: // Data Structures
+
+	// Type of each block of bits.
+	using Block = std::uint64_t;
+
+	// Number of bits in each block.
+	static constexpr std::size_t block_bits{ 64 };
+
+private: // Variables
+
+	// Holds the bits (any bits past the end of the set are always 0).
+	std::pmr::vector<Block> blocks;
+
+	// The number of bits in the set.
+	std::size_t bit_count;
+
+public: // Functions
+
+	// Constructs a set of the given number of bits that are all 0 (or all 1), with its blocks in the given memory resource.
+	inline explicit Bitset(const std::size_t size = 0, const bool value = false, std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+		:
+		blocks((size + block_bits - 1) / block_bits, value ? ~Block{} : Block{}, resource), bit_count{ size }
+	{
+		trim();
+	}
+
+
+	// Returns the number of bits in the set.
+	inline std::size_t size() const noexcept
+	{
+		return bit_count;
+	}
+
+	// Returns the number of bytes that the blocks take up.
+	inline std::size_t memory_usage() const noexcept
+	{
+		return blocks.capacity() * sizeof(Block);
+	}
+
+	// Returns the value of the bit at index i.
+	inline bool test(const std::size_t i) const noexcept
+	{
+		return (blocks[i / block_bits] >> (i % block_bits)) & 1;
+	}
+
+	// Sets the bit at index i to 1.
+	inline void set(const std::size_t i) noexcept
+	{
+		blocks[i / block_bits] |= Block{ 1 } << (i % block_bits);
+	}
+
+	// Sets the bit at index i to 0.
+	inline void reset(const std::size_t i) noexcept
+	{
+		blocks[i / block_bits] &= ~(Block{ 1 } << (i % block_bits));
+	}
+
+	// Returns the number of bits that are 1.
+	inline std::size_t count() const noexcept
+	{
+		std::size_t total{};
+		for (const Block block : blocks)
+			total += popcount(block);
+		return total;
+	}
+
+	// Returns the number of bits that are 1 in a single block.
+	static inline std::size_t popcount(const Block block) noexcept
+	{
+		return std::bitset<block_bits>(block).count();
+	}
+
+	// Returns the index of the lowest bit that is 1 in a single block (the block must not be 0).
+	static inline std::size_t lowest_bit(const Block block) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return std::size_t(__builtin_ctzll(block));
+#else
+		return std::bitset<block_bits>((block & (~block + 1)) - 1).count();
+#endif
+	}
+
+	// Calls the function with the index of every bit that is 1 (in increasing order).
+	template<class Function>
+	inline void for_each(Function&& function) const
+	{
+		for (std::size_t i{}; i < blocks.size(); ++i)
+		{
+			for (Block block{ blocks[i] }; block != 0; block &= block - 1)
+				function(i * block_bits + lowest_bit(block));
+		}
+	}
+
+
+	// Returns the number of blocks.
+	inline std::size_t block_count() const noexcept
+	{
+		return blocks.size();
+	}
+
+	// Returns the block at index i.
+	inline Block block(const std::size_t i) const noexcept
+	{
+		return blocks[i];
+	}
+
+	// Replaces the block at index i (bits past the end of the set must be 0).
+	inline void set_block(const std::size_t i, const Block value) noexcept
+	{
+		blocks[i] = value;
+	}
+
+
+	// Keeps only the bits that are also 1 in the other set.
+	inline Bitset& operator&=(const Bitset& other) noexcept
+	{
+		for (std::size_t i{}; i < blocks.size(); ++i)
+			blocks[i] &= other.blocks[i];
+		return *this;
+	}
+
+	// Keeps only the bits that are 0 in the other set.
+	inline Bitset& and_not(const Bitset& other) noexcept
+	{
+		for (std::size_t i{}; i < blocks.size(); ++i)
+			blocks[i] &= ~other.blocks[i];
+		return *this;
+	}
+
+private: // Helper Functions
+
+	// Clears the unused bits of the last block.
+	inline void trim() noexcept
+	{
+		if (const std::size_t extra{ bit_count % block_bits }; extra != 0)
+			blocks.back() &= (Block{ 1 } << extra) - 1;
+	}
+
+};
+
+// ================================================================================================================================ //
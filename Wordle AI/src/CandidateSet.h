@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include "Bitset.h"
+#include "Dictionary.h"
+
+// ================================================================================================================================ //
+
+/*
+	A set of words of a Dictionary (by WordID), stored as a Bitset.
+	Filtering is done with whole-block AND operations, the size is kept with popcounts, and iterating skips straight to each word
+	with count-trailing-zeros. Copying the set for a new game only copies one bit per word of the Dictionary.
+
+	Words are always visited in increasing WordID order (the same order as a DictionaryView of the whole Dictionary).
+*/
+class CandidateSet
+{
+public: // Data Structures
+
+	// Iterates over the words in the set (in increasing order).
+	class iterator
+	{
+	public: // Data Structures
+
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = WordID;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const WordID*;
+		using reference = WordID;
+
+	private: // Variables
+
+		const Bitset* bits;
+		std::size_t index;
+		Bitset::Block remaining;
+
+	public: // Functions
+
+		inline iterator(const Bitset& bits, const std::size_t index) noexcept
+			:
+			bits{ &bits }, index{ index }, remaining{ index < bits.block_count() ? bits.block(index) : 0 }
+		{
+			skip_empty();
+		}
+
+		inline WordID operator*() const noexcept
+		{
+			return WordID(index * Bitset::block_bits + Bitset::lowest_bit(remaining));
+		}
+
+		inline iterator& operator++() noexcept
+		{
+			remaining &= remaining - 1;
+			skip_empty();
+			return *this;
+		}
+
+		inline iterator operator++(int) noexcept
+		{
+			iterator copy{ *this };
+			++*this;
+			return copy;
+		}
+
+		inline bool operator==(const iterator& other) const noexcept
+		{
+			return (index == other.index) && (remaining == other.remaining);
+		}
+
+		inline bool operator!=(const iterator& other) const noexcept
+		{
+			return !(*this == other);
+		}
+
+	private: // Helper Functions
+
+		// Moves to the next block that has any words left in it.
+		inline void skip_empty() noexcept
+		{
+			while (remaining == 0 && index < bits->block_count())
+			{
+				if (++index < bits->block_count())
+					remaining = bits->block(index);
+			}
+		}
+	};
+
+	using const_iterator = iterator;
+
+private: // Variables
+
+	// The Dictionary that the words are from.
+	const Dictionary* source;
+
+	// One bit per word of the Dictionary.
+	Bitset bits;
+
+	// The number of words in the set.
+	std::size_t count;
+
+public: // Functions
+
+	// Constructs a set of the words of the Dictionary whose bits are set.
+	inline CandidateSet(const Dictionary& dict, const Bitset& words)
+		:
+		source{ &dict }, bits{ words }, count{ words.count() }
+	{}
+
+	// Constructs a set of the words in the DictionaryView that meet the given condition.
+	template<class Predicate>
+	inline CandidateSet(const DictionaryView& view, Predicate&& condition)
+		:
+		source{ &view.dictionary() }, bits(view.dictionary().size()), count{}
+	{
+		for (const WordID id : view)
+		{
+			if (condition(id))
+			{
+				bits.set(id);
+				++count;
+			}
+		}
+	}
+
+
+	// Returns the Dictionary that the words are from.
+	inline const Dictionary& dictionary() const noexcept
+	{
+		return *source;
+	}
+
+	// Returns the word with the given index.
+	inline std::string_view word(const WordID id) const noexcept
+	{
+		return (*source)[id];
+	}
+
+	// Returns the number of words in the set.
+	inline std::size_t size() const noexcept
+	{
+		return count;
+	}
+
+	// Returns true if the set has no words.
+	inline bool empty() const noexcept
+	{
+		return count == 0;
+	}
+
+	// Returns true if the given word is in the set.
+	inline bool contains(const WordID id) const noexcept
+	{
+		return bits.test(id);
+	}
+
+	// Returns the first word in the set (which must not be empty).
+	inline WordID front() const noexcept
+	{
+		return *begin();
+	}
+
+	// Returns the words as a Bitset over the Dictionary.
+	inline const Bitset& words() const noexcept
+	{
+		return bits;
+	}
+
+	// Returns the number of bytes that the set takes up.
+	inline std::size_t memory_usage() const noexcept
+	{
+		return bits.memory_usage();
+	}
+
+	inline iterator begin() const noexcept
+	{
+		return iterator(bits, 0);
+	}
+
+	inline iterator end() const noexcept
+	{
+		return iterator(bits, bits.block_count());
+	}
+
+
+	// Erases the words that meet the given condition from the set.
+	template<class Predicate>
+	inline void erase_if(Predicate&& condition)
+	{
+		for (const WordID id : *this)
+		{
+			if (condition(id))
+			{
+				bits.reset(id);
+				--count;
+			}
+		}
+	}
+
+	// Lets the function change the Bitset directly (the size is counted again afterwards).
+	template<class Function>
+	inline void modify(Function&& function)
+	{
+		function(bits);
+		count = bits.count();
+	}
+
+};
+
+// ================================================================================================================================ //
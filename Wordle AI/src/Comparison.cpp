@@ -0,0 +1,360 @@
+#include "Comparison.h"
+#include "testing.h"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include <unordered_map>
+
+// ================================================================================================================================ //
+
+void write_run(const std::string& filename, const std::string& name, const double seconds, const Dictionary& words, const std::vector<unsigned char>& games)
+{
+	std::ofstream file{ filename };
+	if (!file)
+		throw std::runtime_error("Unable to open output file.");
+
+	file << "# dictionary\t" << name << '\n';
+	file << "# seconds\t" << seconds << '\n';
+	file << "# games\t" << games.size() << '\n';
+	file << "word\tturns\n";
+
+	for (std::size_t i{}; i < words.size(); ++i)
+		file << words[i] << '\t' << unsigned(games[i]) << '\n';
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+RunResults load_run(const std::string& filename)
+{
+	// Names of files in the Tests folder may be given without the folder.
+	const std::string path{ (!std::filesystem::exists(filename) && std::filesystem::exists("./Tests/" + filename)) ? "./Tests/" + filename : filename };
+
+	std::ifstream file{ path };
+	if (!file)
+		throw std::runtime_error("Unable to open results file: " + filename);
+
+	RunResults run{};
+	std::string line{};
+
+	if (file.peek() == '#')
+	{
+		// Machine-readable results: a header of "# <key>\t<value>" lines, a line of column names, then "<word>\t<turns>" lines.
+		while (std::getline(file, line) && !line.empty() && line[0] == '#')
+		{
+			const std::size_t tab{ line.find('\t') };
+			const std::string key{ line.substr(2, tab - 2) };
+			const std::string value{ tab == std::string::npos ? "" : line.substr(tab + 1) };
+
+			if (key == "dictionary")
+				run.name = value;
+			else if (key == "seconds")
+				run.seconds.push_back(std::stod(value));
+		}
+
+		for (std::string word{}; file >> word;)
+		{
+			unsigned turns{};
+			if (!(file >> turns))
+				throw std::runtime_error("Results file is corrupted: " + filename);
+
+			run.games.emplace_back(word, turns);
+		}
+	}
+	else
+	{
+		// A report: the statistics (with the name on the 3rd line, and the time in a "* Took" note), then a "<word>: <N> turns" line per game.
+		bool in_games{ false };
+		for (std::size_t line_number{ 1 }; std::getline(file, line); ++line_number)
+		{
+			if (line_number == 3)
+			{
+				run.name = line;
+			}
+			else if (line.compare(0, 7, "* Took ") == 0)
+			{
+				run.seconds.push_back(std::stod(line.substr(7)));
+			}
+			else if (line == "==== GAME RESULTS ====")
+			{
+				in_games = true;
+			}
+			else if (in_games && !line.empty() && line[0] != '=')
+			{
+				const std::size_t colon{ line.find(':') };
+				if (colon == std::string::npos)
+					throw std::runtime_error("Results file is corrupted: " + filename);
+
+				run.games.emplace_back(line.substr(0, colon), unsigned(std::stoul(line.substr(colon + 1))));
+			}
+		}
+	}
+
+	if (run.games.empty())
+		throw std::runtime_error("No games were found in the results file: " + filename);
+
+	return run;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+RunResults load_runs(const std::string& filenames)
+{
+	RunResults runs{};
+	for (std::size_t first{}; first <= filenames.size();)
+	{
+		const std::size_t comma{ std::min(filenames.find(',', first), filenames.size()) };
+		RunResults run{ load_run(filenames.substr(first, comma - first)) };
+
+		if (runs.games.empty())
+		{
+			runs = std::move(run);
+		}
+		else
+		{
+			if (run.games.size() != runs.games.size())
+				throw std::runtime_error("Runs of the same test must play the same number of games: " + filenames);
+
+			runs.seconds.insert(runs.seconds.end(), run.seconds.begin(), run.seconds.end());
+		}
+		first = comma + 1;
+	}
+	return runs;
+}
+
+// ================================================================================================================================ //
+
+// Totals the results of the games of a run.
+static Stats tally(const RunResults& run)
+{
+	Stats stats{};
+	for (const auto& [word, turns] : run.games)
+	{
+		if (turns <= 6)
+			stats.add_win(turns);
+		else
+			stats.add_loss(turns);
+	}
+	return stats;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the number as it would be printed to a stream (std::to_string always prints 6 decimals).
+static std::string to_text(const double value, const bool show_sign = false)
+{
+	std::ostringstream o{};
+	if (show_sign) o << std::showpos;
+	o << value;
+	return o.str();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the mean of the values, and the variance of that mean (0 for fewer than 2 values).
+static std::pair<double, double> mean_and_error(const std::vector<double>& values)
+{
+	const double n{ double(values.size()) };
+	double sum{};
+	double squares{};
+	for (const double value : values)
+	{
+		sum += value;
+		squares += value * value;
+	}
+
+	const double mean{ sum / n };
+	const double variance{ n < 2 ? 0.0 : std::max(0.0, (squares - n * mean * mean) / (n - 1)) };
+	return { mean, variance / n };
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Prints up to a limited number of words, 10 to a line.
+static void print_words(const std::vector<std::string>& words, const std::size_t limit)
+{
+	for (std::size_t i{}; i < std::min(words.size(), limit); ++i)
+		std::cout << (i % 10 == 0 ? "\n    " : " ") << words[i];
+
+	if (words.size() > limit)
+		std::cout << "\n    ... and " << (words.size() - limit) << " more";
+
+	std::cout << '\n';
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool compare_runs(const std::string& baseline_file, const std::string& candidate_file, const CompareOptions& options)
+{
+	const RunResults baseline{ load_runs(baseline_file) };
+	const RunResults candidate{ load_runs(candidate_file) };
+
+	std::unordered_map<std::string, unsigned> baseline_turns{};
+	for (const auto& [word, turns] : baseline.games)
+		baseline_turns.emplace(word, turns);
+
+	// Only the words that both runs played are compared game by game (a sampled run may only share some of them).
+	struct Change
+	{
+		std::string word;
+		int delta;
+	};
+
+	std::vector<Change> changes{};
+	std::vector<std::string> gained{};
+	std::vector<std::string> lost{};
+	std::size_t shared{};
+	double delta_sum{};
+	double delta_squares{};
+
+	for (const auto& [word, turns] : candidate.games)
+	{
+		const auto found{ baseline_turns.find(word) };
+		if (found == baseline_turns.end()) continue;
+
+		++shared;
+		const int delta{ int(turns) - int(found->second) };
+		delta_sum += delta;
+		delta_squares += double(delta) * delta;
+
+		if (delta != 0)
+			changes.push_back(Change{ word, delta });
+
+		if (found->second > 6 && turns <= 6)
+			gained.push_back(word);
+		else if (found->second <= 6 && turns > 6)
+			lost.push_back(word);
+	}
+
+	if (shared == 0)
+		throw std::runtime_error("The two runs have no words in common.");
+
+	// The change in turns is tested with a paired z-test (the same words are played by both runs, so most of the noise cancels out).
+	const double n{ double(shared) };
+	const double mean_delta{ delta_sum / n };
+	const double delta_stddev{ n < 2 ? 0.0 : std::sqrt(std::max(0.0, (delta_squares - n * mean_delta * mean_delta) / (n - 1))) };
+	const double z{ delta_stddev == 0 ? (mean_delta == 0 ? 0.0 : (mean_delta > 0 ? HUGE_VAL : -HUGE_VAL)) : mean_delta / (delta_stddev / std::sqrt(n)) };
+	const bool turns_significant{ std::abs(z) > 1.96 };
+
+	// Win/loss flips are tested with McNemar's test (with a continuity correction).
+	const double flips{ double(gained.size() + lost.size()) };
+	const double flip_difference{ std::abs(double(gained.size()) - double(lost.size())) };
+	const double chi_squared{ flips == 0 ? 0.0 : std::pow(std::max(0.0, flip_difference - 1), 2) / flips };
+	const bool flips_significant{ chi_squared > 3.841 };
+
+	const Stats base_stats{ tally(baseline) };
+	const Stats cand_stats{ tally(candidate) };
+
+	const bool timed{ !baseline.seconds.empty() && !candidate.seconds.empty() };
+	const auto [base_seconds, base_error] { timed ? mean_and_error(baseline.seconds) : std::pair{ 0.0, 0.0 } };
+	const auto [cand_seconds, cand_error] { timed ? mean_and_error(candidate.seconds) : std::pair{ 0.0, 0.0 } };
+	const bool timed_valid{ timed && base_seconds > 0 && cand_seconds > 0 };
+
+	const double time_change{ timed_valid ? 100.0 * (cand_seconds - base_seconds) / base_seconds : 0.0 };
+	const double base_throughput{ timed_valid ? baseline.games.size() / base_seconds : 0.0 };
+	const double cand_throughput{ timed_valid ? candidate.games.size() / cand_seconds : 0.0 };
+
+	// With several timings of both runs, the change in time is tested with Welch's t-test (read against the same 1.96 as the turns).
+	// With single timings there is no estimate of the noise, so only runs that are long enough to be steady are judged (against a fixed band).
+	const bool repeated{ baseline.seconds.size() > 1 && candidate.seconds.size() > 1 };
+	const double time_error{ std::sqrt(base_error + cand_error) };
+	const double t{ time_error == 0 ? (cand_seconds == base_seconds ? 0.0 : (cand_seconds > base_seconds ? HUGE_VAL : -HUGE_VAL)) : (cand_seconds - base_seconds) / time_error };
+	const bool time_judged{ timed_valid && (repeated || base_seconds >= options.min_seconds) };
+	const bool time_significant{ repeated ? std::abs(t) > 1.96 : true };
+
+	std::cout << "\n========================== WORDLE AI COMPARE =========================\n\n";
+	std::cout << " Baseline:   " << baseline_file << " (" << baseline.name << ", " << baseline.games.size() << " games)\n";
+	std::cout << "Candidate:   " << candidate_file << " (" << candidate.name << ", " << candidate.games.size() << " games)\n";
+
+	if (shared != baseline.games.size() || shared != candidate.games.size())
+		std::cout << "* Only the " << shared << " words that both runs played are compared game by game.\n";
+
+	std::cout
+		<< '\n' << std::left
+		<< "              " << std::setw(14) << "Baseline" << std::setw(14) << "Candidate" << "Change\n"
+		<< "  Win Ratio:  " << std::setw(14) << (to_text(base_stats.win_ratio()) + '%') << std::setw(14) << (to_text(cand_stats.win_ratio()) + '%')
+		<< to_text(cand_stats.win_ratio() - base_stats.win_ratio(), true) << "%\n"
+		<< "  Turn Avg.:  " << std::setw(14) << base_stats.average_turns() << std::setw(14) << cand_stats.average_turns()
+		<< to_text(cand_stats.average_turns() - base_stats.average_turns(), true) << '\n';
+
+	if (timed_valid)
+	{
+		std::cout
+			<< "    Seconds:  " << std::setw(14) << base_seconds << std::setw(14) << cand_seconds << to_text(time_change, true) << "%\n"
+			<< "    Games/s:  " << std::setw(14) << base_throughput << std::setw(14) << cand_throughput
+			<< to_text(100.0 * (cand_throughput - base_throughput) / base_throughput, true) << "%\n";
+	}
+	std::cout << std::right;
+
+	if (timed_valid)
+	{
+		std::cout << "  (" << baseline.seconds.size() << " vs " << candidate.seconds.size() << " timings: ";
+		if (repeated)
+			std::cout << "Welch t = " << t << ", " << (time_significant ? "significant" : "not significant") << " at 95%)\n";
+		else if (time_judged)
+			std::cout << "no noise estimate, so a change within " << to_text(options.time_percent) << "% is treated as noise)\n";
+		else
+			std::cout << "shorter than " << to_text(options.min_seconds) << " s, which is too noisy to judge from single timings)\n";
+	}
+
+	const std::size_t better{ std::size_t(std::count_if(changes.begin(), changes.end(), [](const Change& c) { return c.delta < 0; })) };
+	std::cout << "\nPer-Word Changes: " << better << " better, " << (changes.size() - better) << " worse, " << (shared - changes.size()) << " unchanged.\n";
+	std::cout << "  Mean Change:   " << to_text(mean_delta, true) << " turns per word (z = " << z << ", " << (turns_significant ? "significant" : "not significant") << " at 95%)\n";
+
+	// The largest changes are listed first.
+	std::stable_sort(changes.begin(), changes.end(), [](const Change& a, const Change& b) { return std::abs(a.delta) > std::abs(b.delta); });
+
+	std::vector<std::string> largest{};
+	for (std::size_t i{}; i < std::min<std::size_t>(changes.size(), 20); ++i)
+		largest.push_back(changes[i].word + " (" + to_text(changes[i].delta, true) + ")");
+
+	if (!largest.empty())
+	{
+		std::cout << "  Largest Changes:";
+		print_words(largest, 20);
+	}
+
+	std::cout << "\nWin/Loss Flips: " << gained.size() << " gained, " << lost.size() << " lost (McNemar chi^2 = " << chi_squared << ", "
+		<< (flips_significant ? "significant" : "not significant") << " at 95%)\n";
+
+	if (!gained.empty())
+	{
+		std::cout << "  Lost -> Won:";
+		print_words(gained, 50);
+	}
+	if (!lost.empty())
+	{
+		std::cout << "  Won -> Lost:";
+		print_words(lost, 50);
+	}
+
+	// A change is only a regression if it is larger than the threshold and (for the games) larger than the noise.
+	std::vector<std::string> regressions{};
+	if (mean_delta > options.turns && turns_significant)
+		regressions.push_back("the average number of turns rose by " + to_text(mean_delta) + " (threshold " + to_text(options.turns) + ")");
+	if (lost.size() > gained.size() && flips_significant)
+		regressions.push_back(std::to_string(lost.size() - gained.size()) + " more games were lost than were won back");
+	if (time_judged && time_significant && time_change > options.time_percent)
+		regressions.push_back("the run was " + to_text(time_change) + "% slower (threshold " + to_text(options.time_percent) + "%)");
+
+	if (regressions.empty())
+	{
+		std::cout << "\nResult: No regressions.\n";
+	}
+	else
+	{
+		std::cout << "\nResult: REGRESSION\n";
+		for (const std::string& regression : regressions)
+			std::cout << "  * " << regression << '\n';
+	}
+
+	std::cout << "\n======================================================================\n\n";
+
+	return !regressions.empty();
+}
+
+// ================================================================================================================================ //
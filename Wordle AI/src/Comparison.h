@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+#include <string>
+#include <utility>
+
+#include "Dictionary.h"
+
+// ================================================================================================================================ //
+
+// The results of a single test run, as read back from its results file.
+struct RunResults
+{
+	// The name of the dictionary that was tested.
+	std::string name;
+
+	// How long the run took, once for every time that it was timed (empty if the files do not say).
+	std::vector<double> seconds;
+
+	// Every word that was played, and the number of turns that it took.
+	std::vector<std::pair<std::string, unsigned>> games;
+};
+
+// The thresholds above which compare_runs() reports a change as a regression.
+struct CompareOptions
+{
+	// How much the average number of turns may rise (if the rise is also statistically significant).
+	double turns{ 0.0 };
+
+	// How much slower (as a percentage of the baseline's time) the run may be.
+	// With several timings of each run, the slowdown must also be statistically significant; with single timings it is a fixed noise band.
+	double time_percent{ 20.0 };
+
+	// Runs that take less time than this (in seconds) are too noisy to judge from single timings, so their time is not judged.
+	double min_seconds{ 1.0 };
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Writes the machine-readable results of a run (tab-separated, with a '#' header), which load_run() reads back.
+void write_run(const std::string& filename, const std::string& name, const double seconds, const Dictionary& words, const std::vector<unsigned char>& games);
+
+// Reads a run from either a machine-readable file or a "Results.txt" report.
+RunResults load_run(const std::string& filename);
+
+// Reads several runs of the same test, given as a comma-separated list of files: the games of the first, and the timings of all of them.
+RunResults load_runs(const std::string& filenames);
+
+// Prints the differences between two runs, and returns true if the candidate regressed from the baseline beyond the thresholds.
+// Either run may be given as several files (see load_runs()), which gives the time a noise estimate.
+bool compare_runs(const std::string& baseline_file, const std::string& candidate_file, const CompareOptions& options = {});
+
+// ================================================================================================================================ //
@@ -0,0 +1,239 @@
+#include "Dawg.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <tuple>
+
+// ================================================================================================================================ //
+
+// Edges hold the index of their letter in their lowest bits.
+inline constexpr std::uint32_t letter_bits{ 8 };
+
+static_assert(max_letters <= (1u << letter_bits), "Every letter index must fit in an edge.");
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+WordConstraints::WordConstraints(const std::size_t length)
+	:
+	length{ length }, allowed(length, LetterSet::all()), min_count{}, max_count{}
+{
+	max_count.fill(std::uint8_t(std::min<std::size_t>(length, 255)));
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void WordConstraints::add(const Results& feedback)
+{
+	if (feedback.size() != length)
+		throw std::runtime_error("Feedback size does not equal the length of the constraints.");
+
+	for (std::size_t i{}; i < feedback.size(); ++i)
+	{
+		const Feedback f{ feedback[i] };
+		const std::size_t letter{ letter_index(f.letter) };
+
+		// Number of non-invalid occurrences of the current letter in the guess.
+		const auto count{ std::uint8_t(std::count_if(feedback.begin(), feedback.end(),
+			[=](const Feedback fb) { return (fb.letter == f.letter) && (fb.result != Result::Invalid); }
+		))};
+
+		if (f.result == Result::Correct)
+		{
+			const bool was_allowed{ allowed[i].contains(letter) };
+			allowed[i].clear();
+			if (was_allowed)
+				allowed[i].insert(letter);
+		}
+		else
+		{
+			allowed[i].erase(letter);
+		}
+
+		min_count[letter] = std::max(min_count[letter], count);
+
+		// Invalid letters also give the exact number of occurrences.
+		if (f.result == Result::Invalid)
+			max_count[letter] = std::min(max_count[letter], count);
+	}
+}
+
+// ================================================================================================================================ //
+
+Dawg::Dawg(const Dictionary& dict)
+	:
+	first_edge{}, edges{}, nodes{}
+{
+	for (std::size_t i{ 1 }; i < dict.size(); ++i)
+	{
+		if (!(dict[i - 1] < dict[i]))
+			throw std::runtime_error("A DAWG requires a sorted Dictionary without repeated words.");
+	}
+
+	// The graph is built with the incremental algorithm for sorted words (Daciuk et al.):
+	// once a word has been added, the nodes of the previous word past their common prefix can no longer change,
+	// so each of them is replaced by an equivalent node that is already in the registry (or added to it).
+	struct BuildNode
+	{
+		std::vector<std::pair<std::uint8_t, std::uint32_t>> edges;
+		bool final;
+	};
+
+	std::vector<BuildNode> graph(1);
+	std::unordered_map<std::string, std::uint32_t> registry{};
+	std::vector<std::tuple<std::uint32_t, std::uint8_t, std::uint32_t>> unchecked{};
+
+	// Two nodes are equivalent if they are both final (or not) and have the same edges to the same nodes.
+	const auto signature = [&](const std::uint32_t node)
+	{
+		std::string key(1, graph[node].final ? '1' : '0');
+		for (const auto& [letter, child] : graph[node].edges)
+		{
+			key.push_back(char(letter));
+			key.append(reinterpret_cast<const char*>(&child), sizeof(child));
+		}
+		return key;
+	};
+
+	const auto minimize = [&](const std::size_t down_to)
+	{
+		while (unchecked.size() > down_to)
+		{
+			const auto [parent, letter, child] { unchecked.back() };
+			unchecked.pop_back();
+
+			const auto [existing, inserted] { registry.try_emplace(signature(child), child) };
+			if (!inserted)
+				graph[parent].edges.back().second = existing->second;
+		}
+	};
+
+	std::string_view previous{};
+	for (const std::string_view word : dict)
+	{
+		const std::size_t prefix{ std::size_t(std::mismatch(word.begin(), word.end(), previous.begin(), previous.end()).first - word.begin()) };
+		minimize(prefix);
+
+		std::uint32_t node{ unchecked.empty() ? 0 : std::get<2>(unchecked.back()) };
+		for (std::size_t i{ prefix }; i < word.size(); ++i)
+		{
+			const std::uint32_t child{ std::uint32_t(graph.size()) };
+			const std::uint8_t letter{ std::uint8_t(letter_index(word[i])) };
+
+			graph.push_back(BuildNode{});
+			graph[node].edges.emplace_back(letter, child);
+			unchecked.emplace_back(node, letter, child);
+			node = child;
+		}
+		graph[node].final = true;
+
+		previous = word;
+	}
+	minimize(0);
+
+	// Only the nodes that can still be reached are kept, numbered in the order that they are first reached.
+	std::vector<std::uint32_t> renumber(graph.size(), ~std::uint32_t{});
+	std::vector<std::uint32_t> order{ 0 };
+	renumber[0] = 0;
+
+	for (std::size_t i{}; i < order.size(); ++i)
+	{
+		for (const auto& [letter, child] : graph[order[i]].edges)
+		{
+			if (renumber[child] == ~std::uint32_t{})
+			{
+				renumber[child] = std::uint32_t(order.size());
+				order.push_back(child);
+			}
+		}
+	}
+
+	// Word counts depend on the counts of the children, which are only known once every node below has been counted.
+	std::vector<std::uint32_t> counts(graph.size(), ~std::uint32_t{});
+	const std::function<std::uint32_t(std::uint32_t)> count_words = [&](const std::uint32_t node) -> std::uint32_t
+	{
+		if (counts[node] == ~std::uint32_t{})
+		{
+			std::uint32_t total{ graph[node].final ? 1u : 0u };
+			for (const auto& [letter, child] : graph[node].edges)
+				total += count_words(child);
+			counts[node] = total;
+		}
+		return counts[node];
+	};
+
+	if (order.size() > (std::size_t{ 1 } << (32 - letter_bits)))
+		throw std::runtime_error("The DAWG has too many nodes for its edges to hold.");
+
+	nodes.reserve(order.size());
+	first_edge.reserve(order.size() + 1);
+
+	for (const std::uint32_t node : order)
+	{
+		first_edge.push_back(std::uint32_t(edges.size()));
+		nodes.push_back((count_words(node) << 1) | (graph[node].final ? 1u : 0u));
+
+		for (const auto& [letter, child] : graph[node].edges)
+			edges.push_back((renumber[child] << letter_bits) | letter);
+	}
+	first_edge.push_back(std::uint32_t(edges.size()));
+}
+
+// ================================================================================================================================ //
+
+std::vector<WordID> Dawg::matching(const WordConstraints& constraints) const
+{
+	std::vector<WordID> words{};
+	if (constraints.length == 0)
+		return words;
+
+	std::array<std::uint8_t, max_letters> counts{};
+
+	// Number of letters that the prefix still needs (for the letters that must occur more often than they do so far).
+	std::size_t missing{};
+	for (const std::uint8_t count : constraints.min_count)
+		missing += count;
+
+	// The WordID of the first word that is completed from a node is passed down, and is moved past every subtree that is skipped.
+	const std::function<void(std::uint32_t, std::size_t, WordID)> walk = [&](const std::uint32_t node, const std::size_t depth, WordID id)
+	{
+		if (depth == constraints.length)
+		{
+			if (is_final(node) && missing == 0)
+				words.push_back(id);
+			return;
+		}
+
+		id += is_final(node) ? 1 : 0;
+		const std::size_t remaining{ constraints.length - depth - 1 };
+
+		for (std::uint32_t e{ first_edge[node] }; e < first_edge[node + 1]; ++e)
+		{
+			const std::uint32_t child{ edges[e] >> letter_bits };
+			const std::uint32_t letter{ edges[e] & ((1u << letter_bits) - 1) };
+
+			const bool needed{ counts[letter] < constraints.min_count[letter] };
+			const bool allowed{ constraints.allowed[depth].contains(letter) && (counts[letter] < constraints.max_count[letter]) };
+
+			// The subtree is pruned if the letter is not allowed here, or if the rest of the word is too short for the letters still needed.
+			if (allowed && (missing - (needed ? 1 : 0)) <= remaining)
+			{
+				++counts[letter];
+				missing -= needed ? 1 : 0;
+
+				walk(child, depth + 1, id);
+
+				missing += needed ? 1 : 0;
+				--counts[letter];
+			}
+
+			id += word_count(child);
+		}
+	};
+
+	walk(0, 0, 0);
+	return words;
+}
+
+// ================================================================================================================================ //
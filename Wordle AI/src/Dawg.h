@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+
+#include "Dictionary.h"
+#include "WordleSim.h"
+
+// ================================================================================================================================ //
+
+/*
+	The constraints that the Feedback of a game puts on the answer, in the form that a walk over a DAWG can check letter by letter.
+	They follow the same rules as WordleAI::updateDictionary().
+*/
+struct WordConstraints
+{
+public: // Variables
+
+	// The length of the answer.
+	std::size_t length;
+
+	// [Position] -> The letters that the answer can have at the Position.
+	std::vector<LetterSet> allowed;
+
+	// [Letter Index] -> The fewest and the most times that the Letter can occur in the answer.
+	std::array<std::uint8_t, max_letters> min_count;
+	std::array<std::uint8_t, max_letters> max_count;
+
+public: // Functions
+
+	// Constructs the constraints of a game that has had no guesses yet.
+	explicit WordConstraints(const std::size_t length);
+
+	// Adds the constraints of the Feedback of another guess.
+	void add(const Results& feedback);
+
+};
+
+// ================================================================================================================================ //
+
+/*
+	A Directed Acyclic Word Graph (a minimal automaton) of the words of a Dictionary.
+	Words that share a prefix share the path for it, and words that share a suffix share the nodes for it, so the whole Scrabble Dictionary
+	(175k words) takes under 1 MB.
+
+	Every node knows how many words can be completed from it, so the WordID (the rank in the sorted Dictionary) of each word is found on the
+	way down. Enumerating the words that meet some WordConstraints prunes a whole subtree as soon as its prefix breaks a constraint,
+	instead of rejecting every word in it on its own.
+*/
+class Dawg
+{
+private: // Variables
+
+	// [Node] -> Index of the first edge of the Node (the edges of a Node are contiguous, and sorted by letter).
+	std::vector<std::uint32_t> first_edge;
+
+	// [Edge] -> (Target Node << 8) | Letter Index.
+	std::vector<std::uint32_t> edges;
+
+	// [Node] -> (Number of words completed from the Node << 1) | (1 if a word ends at the Node).
+	std::vector<std::uint32_t> nodes;
+
+public: // Functions
+
+	// Builds the DAWG of a Dictionary (which must be sorted, and hold no repeated words).
+	explicit Dawg(const Dictionary& dict);
+
+	// Returns the WordIDs of the words that meet the constraints (in increasing order).
+	std::vector<WordID> matching(const WordConstraints& constraints) const;
+
+	// Returns the number of nodes.
+	inline std::size_t node_count() const noexcept
+	{
+		return nodes.size();
+	}
+
+	// Returns the number of bytes used by the graph.
+	inline std::size_t memory_usage() const noexcept
+	{
+		return (first_edge.size() + edges.size() + nodes.size()) * sizeof(std::uint32_t);
+	}
+
+private: // Helper Functions
+
+	// Returns the number of words completed from the node.
+	inline std::uint32_t word_count(const std::uint32_t node) const noexcept
+	{
+		return nodes[node] >> 1;
+	}
+
+	// Returns true if a word ends at the node.
+	inline bool is_final(const std::uint32_t node) const noexcept
+	{
+		return nodes[node] & 1;
+	}
+
+};
+
+// ================================================================================================================================ //
@@ -1,62 +1,235 @@
 #include "Dictionary.h"
 
 #include <stdexcept>
+#include <algorithm>
 #include <fstream>
 #include <random>
 #include <string>
+#include <iterator>
+#include <initializer_list>
+
+#include "Random.h"
+#include "Embedded.h"
 
 // ================================================================================================================================ //
 
-Dictionary load_dictionary(const char* const filename, const std::size_t word_length, const bool allow_empty)
+void Dictionary::push_back(const std::string_view word)
 {
-	Dictionary dict{};
+	chars.append(word);
+	offsets.push_back(static_cast<std::uint32_t>(chars.size()));
+}
 
-	std::ifstream file{ filename };
-	if (!file)
-		throw std::runtime_error("Unable to open Dictionary File.");
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void Dictionary::reserve(const std::size_t words, const std::size_t characters)
+{
+	chars.reserve(characters);
+	offsets.reserve(words + 1);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void Dictionary::sort()
+{
+	std::vector<std::string_view> words(begin(), end());
+	std::sort(words.begin(), words.end());
 
-	constexpr auto is_normal = [](const unsigned char chr)
+	std::pmr::string sorted{ chars.get_allocator() };
+	sorted.reserve(chars.size());
+
+	for (std::size_t i{}; i < words.size(); ++i)
 	{
-		return (chr < 0x80) && std::isalpha(chr);
+		offsets[i] = static_cast<std::uint32_t>(sorted.size());
+		sorted.append(words[i]);
+	}
+	offsets[words.size()] = static_cast<std::uint32_t>(sorted.size());
+
+	chars.swap(sorted);
+}
+
+// ================================================================================================================================ //
+
+// Calls the function with every word of the text (separated by whitespace), with its number of letters (or 0 if it has a character
+// that is not a letter), and every letter past ASCII in it.
+template<class Function>
+static void for_each_token(const std::string_view text, Function&& function)
+{
+	constexpr auto is_space = [](const unsigned char chr)
+	{
+		return std::isspace(chr) != 0;
 	};
 
-	while (file.good())
+	std::vector<char32_t> extra{};
+	for (auto first{ text.begin() }; first != text.end();)
 	{
-		std::string word{};
-		file >> word;
+		first = std::find_if_not(first, text.end(), is_space);
+		const auto last{ std::find_if(first, text.end(), is_space) };
 
-		const bool lengths_match{ (word_length == any_length) || (word.size() == word_length) };
+		const std::string_view token{ text.substr(std::size_t(first - text.begin()), std::size_t(last - first)) };
+		extra.clear();
 
-		if (!word.empty() && lengths_match)
+		std::size_t size{};
+		for (std::string_view rest{ token }; !rest.empty(); ++size)
 		{
-			if (std::all_of(word.begin(), word.end(), is_normal))
-			{
-				make_lowercase(word);
-				dict.push_back(word);
-			}
-			else
+			const char32_t letter{ read_letter(rest) };
+			if (letter == 0)
 			{
-				throw std::runtime_error("Irregular characters found in word from dictionary.");
+				size = 0;
+				break;
 			}
+
+			if (letter >= 0x80)
+				extra.push_back(letter);
 		}
+
+		if (!token.empty())
+			function(token, size, extra);
+
+		first = last;
 	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the letters past ASCII of every regular word in the text.
+static std::vector<char32_t> letters_of(const std::string_view text)
+{
+	std::vector<char32_t> letters{};
+	for_each_token(text, [&](const std::string_view, const std::size_t size, const std::vector<char32_t>& extra)
+	{
+		if (size != 0)
+			letters.insert(letters.end(), extra.begin(), extra.end());
+	});
+	return letters;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the text of the given file.
+static std::string read_text(const char* const filename)
+{
+	std::ifstream file{ filename };
+	if (!file)
+		throw std::runtime_error("Unable to open Dictionary File.");
+
+	return std::string{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Dictionary parse_dictionary(const std::string_view text, const std::size_t word_length, const bool allow_empty, const std::shared_ptr<const Alphabet>& alphabet)
+{
+	Dictionary dict{};
+	dict.set_alphabet(alphabet ? alphabet : Alphabet::shared(letters_of(text)));
+
+	// The first pass finds the words of the given length, and the second stores them in the codes of the Alphabet.
+	std::vector<std::string_view> words{};
+	std::size_t characters{};
+
+	for_each_token(text, [&](const std::string_view token, const std::size_t size, const std::vector<char32_t>&)
+	{
+		// A word with irregular characters has no length in letters, so its length in bytes is checked instead.
+		const bool is_normal{ size != 0 };
+		const bool lengths_match{ (word_length == any_length) || ((is_normal ? size : token.size()) == word_length) };
+		if (!lengths_match) return;
+
+		if (!is_normal)
+			throw std::runtime_error("Irregular characters found in word from dictionary.");
+
+		words.push_back(token);
+		characters += size;
+	});
 
+	if (words.empty() && !allow_empty)
+		throw std::runtime_error("Dictionary does not contain any words of the given length.");
+
+	dict.reserve(words.size(), characters);
+
+	std::string word{};
+	for (const std::string_view token : words)
+	{
+		if (!dict.alphabet().encode(token, word))
+			throw std::runtime_error("Word from dictionary has a letter that is not in its Alphabet.");
+
+		dict.push_back(word);
+	}
+
+	dict.sort();
+
+	return dict;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Dictionary read_dictionary(const char* const filename, const std::size_t word_length, const bool allow_empty, const std::shared_ptr<const Alphabet>& alphabet)
+{
+	return parse_dictionary(read_text(filename), word_length, allow_empty, alphabet);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Dictionary load_dictionary(const char* const filename, const std::size_t word_length, const bool allow_empty, const std::shared_ptr<const Alphabet>& alphabet)
+{
+	const EmbeddedDictionary* const embedded{ find_embedded(filename) };
+	if (!embedded)
+		return read_dictionary(filename, word_length, allow_empty, alphabet);
+
+	// The embedded words were checked and sorted when they were embedded. They are English, and English letters have the same
+	// codes in every Alphabet.
+	Dictionary dict{ load_embedded(*embedded, word_length) };
 	if (dict.empty() && !allow_empty)
 		throw std::runtime_error("Dictionary does not contain any words of the given length.");
 
-	std::sort(dict.begin(), dict.end());
+	if (alphabet)
+		dict.set_alphabet(alphabet);
 
 	return dict;
 }
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
+// Returns the Alphabet of the letters of every word in the given files (embedded files are English).
+static std::shared_ptr<const Alphabet> files_alphabet(const std::initializer_list<const char*> filenames)
+{
+	std::vector<char32_t> letters{};
+	for (const char* const filename : filenames)
+	{
+		if (find_embedded(filename)) continue;
+
+		const std::vector<char32_t> file_letters{ letters_of(read_text(filename)) };
+		letters.insert(letters.end(), file_letters.begin(), file_letters.end());
+	}
+	return Alphabet::shared(std::move(letters));
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+const std::shared_ptr<const Alphabet>& dictionary_alphabet(const DictType type)
+{
+	switch (type)
+	{
+	case DictType::Wordle:
+	{
+		static const std::shared_ptr<const Alphabet> alphabet{ files_alphabet({ wordle_answers_file, wordle_guesses_file }) };
+		return alphabet;
+	}
+	case DictType::Scrabble:
+	{
+		static const std::shared_ptr<const Alphabet> alphabet{ files_alphabet({ scrabble_file }) };
+		return alphabet;
+	}
+	}
+	throw std::runtime_error("Invalid Dictionary.");
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
 Dictionary load_answers(const DictType type, const std::size_t word_length, const bool allow_empty)
 {
 	switch (type)
 	{
-	case DictType::Wordle:   return load_dictionary("../Dictionaries/wordle-answers.txt", word_length, allow_empty);
-	case DictType::Scrabble: return load_dictionary("../Dictionaries/scrabble-dict.txt", word_length, allow_empty);
+	case DictType::Wordle:   return load_dictionary(wordle_answers_file, word_length, allow_empty, dictionary_alphabet(type));
+	case DictType::Scrabble: return load_dictionary(scrabble_file, word_length, allow_empty, dictionary_alphabet(type));
 	}
 	throw std::runtime_error("Invalid Answers Dictionary.");
 }
@@ -67,12 +240,20 @@ Dictionary load_guesses(const DictType type, const std::size_t word_length, cons
 {
 	switch (type)
 	{
-	case DictType::Wordle:   return load_dictionary("../Dictionaries/wordle-guesses.txt", word_length, allow_empty);
-	case DictType::Scrabble: return load_dictionary("../Dictionaries/scrabble-dict.txt", word_length, allow_empty);
+	case DictType::Wordle:   return load_dictionary(wordle_guesses_file, word_length, allow_empty, dictionary_alphabet(type));
+	case DictType::Scrabble: return load_dictionary(scrabble_file, word_length, allow_empty, dictionary_alphabet(type));
 	}
 	throw std::runtime_error("Invalid Guesses Dictionary.");
 }
 
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void require_same_alphabet(const Dictionary& answers, const Dictionary& guesses)
+{
+	if (answers.shared_alphabet() != guesses.shared_alphabet())
+		throw std::runtime_error("The answers and the guesses are not stored in the same Alphabet.");
+}
+
 // ================================================================================================================================ //
 
 std::string pick_word(const Dictionary& dict)
@@ -84,13 +265,33 @@ std::string pick_word(const Dictionary& dict)
 	else
 	{
 		std::string guess{};
-		std::sample(dict.begin(), dict.end(), &guess, 1, std::random_device{});
+		std::sample(dict.begin(), dict.end(), &guess, 1, thread_random());
 		return guess;
 	}
 }
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
+Dictionary sample_words(const Dictionary& dict, const std::size_t count)
+{
+	std::vector<std::size_t> indices(dict.size());
+	for (std::size_t i{}; i < indices.size(); ++i)
+		indices[i] = i;
+
+	std::vector<std::size_t> chosen{};
+	std::sample(indices.begin(), indices.end(), std::back_inserter(chosen), count, thread_random());
+	std::sort(chosen.begin(), chosen.end());
+
+	Dictionary sample{};
+	sample.set_alphabet(dict.shared_alphabet());
+	for (const std::size_t i : chosen)
+		sample.push_back(dict[i]);
+
+	return sample;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
 const std::string& pick_word(const Dictionary& dict, const std::string& word)
 {
 	if (!std::binary_search(dict.begin(), dict.end(), word))
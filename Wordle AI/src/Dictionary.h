@@ -1,27 +1,212 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
+#include <memory>
 #include <vector>
+#include <iterator>
 #include <string>
 #include <string_view>
+#include <memory_resource>
 
 #include <algorithm>
 
+#include "Alphabet.h"
+
 // ================================================================================================================================ //
 
+// Index of a Word in a Dictionary.
+using WordID = std::uint32_t;
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
 /*
 	Holds a collection of Words.
+	Every word is stored back-to-back in a single buffer of characters, and is accessed as a std::string_view into it.
+	This costs a few bytes per word (instead of a std::string each), and keeps neighbouring words next to each other in memory.
+
+	The words are stored in the codes of the Dictionary's Alphabet (one char per letter, which is the letter itself for English).
+	The buffers can be placed in any memory resource (copies are made in the default one, unless another one is given).
 */
-class Dictionary : public std::vector<std::string>
+class Dictionary
 {
-public:
+public: // Data Structures
+
+	// Random-Access iterator over the words (dereferences to a std::string_view).
+	class iterator
+	{
+	private: // Variables
+
+		const Dictionary* dict;
+		std::size_t i;
+
+	public: // Data Structures
+
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = std::string_view;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const std::string_view*;
+		using reference = std::string_view;
+
+	public: // Functions
+
+		inline iterator(const Dictionary* const dict = nullptr, const std::size_t i = 0) noexcept : dict{ dict }, i{ i } {}
+
+		inline reference operator*() const noexcept { return (*dict)[i]; }
+		inline reference operator[](const difference_type n) const noexcept { return (*dict)[i + n]; }
+
+		inline iterator& operator++() noexcept { ++i; return *this; }
+		inline iterator& operator--() noexcept { --i; return *this; }
+		inline iterator operator++(int) noexcept { iterator tmp{ *this }; ++i; return tmp; }
+		inline iterator operator--(int) noexcept { iterator tmp{ *this }; --i; return tmp; }
+
+		inline iterator& operator+=(const difference_type n) noexcept { i += n; return *this; }
+		inline iterator& operator-=(const difference_type n) noexcept { i -= n; return *this; }
+		inline iterator operator+(const difference_type n) const noexcept { return iterator{ dict, i + n }; }
+		inline iterator operator-(const difference_type n) const noexcept { return iterator{ dict, i - n }; }
+		inline difference_type operator-(const iterator& other) const noexcept { return difference_type(i) - difference_type(other.i); }
+		friend inline iterator operator+(const difference_type n, const iterator& it) noexcept { return it + n; }
+
+		inline bool operator==(const iterator& other) const noexcept { return i == other.i; }
+		inline bool operator!=(const iterator& other) const noexcept { return i != other.i; }
+		inline bool operator< (const iterator& other) const noexcept { return i <  other.i; }
+		inline bool operator> (const iterator& other) const noexcept { return i >  other.i; }
+		inline bool operator<=(const iterator& other) const noexcept { return i <= other.i; }
+		inline bool operator>=(const iterator& other) const noexcept { return i >= other.i; }
+	};
+
+	using const_iterator = iterator;
+	using value_type = std::string_view;
+	using size_type = std::size_t;
+
+private: // Variables
+
+	// Every word, back-to-back.
+	std::pmr::string chars;
+
+	// Where each word starts in chars (followed by where the last word ends).
+	std::pmr::vector<std::uint32_t> offsets{ 0 };
+
+	// The letters that the words are made of (shared by every copy of the Dictionary).
+	std::shared_ptr<const Alphabet> letters{ Alphabet::english() };
+
+public: // Functions
+
+	// Constructs an empty Dictionary.
+	Dictionary() = default;
+
+	// Constructs an empty Dictionary, with its buffers in the given memory resource.
+	inline explicit Dictionary(std::pmr::memory_resource* const resource)
+		:
+		chars{ resource }, offsets(1, 0, resource)
+	{}
+
+	// Constructs a copy of the Dictionary, with its buffers in the given memory resource.
+	inline Dictionary(const Dictionary& other, std::pmr::memory_resource* const resource)
+		:
+		chars{ other.chars, resource }, offsets{ other.offsets, resource }, letters{ other.letters }
+	{}
+
+	Dictionary(const Dictionary&) = default;
+	Dictionary(Dictionary&&) = default;
+	Dictionary& operator=(const Dictionary&) = default;
+	Dictionary& operator=(Dictionary&&) = default;
+
+	// Returns the number of words.
+	inline std::size_t size() const noexcept
+	{
+		return offsets.size() - 1;
+	}
+
+	// Returns true if there are no words.
+	inline bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	// Returns the number of bytes that the buffers take up (the Alphabet is shared, so it is not counted).
+	inline std::size_t memory_usage() const noexcept
+	{
+		return chars.capacity() + offsets.capacity() * sizeof(std::uint32_t);
+	}
+
+	// Returns the word at index i.
+	inline std::string_view operator[](const std::size_t i) const noexcept
+	{
+		return std::string_view{ chars.data() + offsets[i], std::size_t(offsets[i + 1] - offsets[i]) };
+	}
+
+	// Returns the first word.
+	inline std::string_view front() const noexcept
+	{
+		return (*this)[0];
+	}
+
+	// Returns the last word.
+	inline std::string_view back() const noexcept
+	{
+		return (*this)[size() - 1];
+	}
+
+	inline iterator begin() const noexcept
+	{
+		return iterator{ this, 0 };
+	}
+
+	inline iterator end() const noexcept
+	{
+		return iterator{ this, size() };
+	}
+
+
+	// Returns the letters that the words are made of.
+	inline const Alphabet& alphabet() const noexcept
+	{
+		return *letters;
+	}
+
+	// Returns the Alphabet, to share it with another Dictionary of the same letters.
+	inline const std::shared_ptr<const Alphabet>& shared_alphabet() const noexcept
+	{
+		return letters;
+	}
+
+	// Sets the letters that the words are made of (the words must be stored in its codes).
+	inline void set_alphabet(std::shared_ptr<const Alphabet> alphabet) noexcept
+	{
+		letters = std::move(alphabet);
+	}
+
+
+	// Adds a word to the end of the dictionary.
+	void push_back(const std::string_view word);
+
+	// Reserves space for the given number of words and characters.
+	void reserve(const std::size_t words, const std::size_t characters);
+
+	// Sorts the words into alphabetical order.
+	void sort();
 
 	// Erases the words that meet the given condition from the dictionary.
 	template<class Predicate>
 	inline void erase_if(Predicate&& condition)
 	{
-		erase(std::remove_if(begin(), end(), condition), end());
+		// Kept words are moved towards the front of the buffer, which never overwrites a word that has not been visited yet.
+		std::size_t kept{};
+		std::uint32_t end{};
+		for (std::size_t i{}; i < size(); ++i)
+		{
+			const std::string_view word{ (*this)[i] };
+			if (condition(word)) continue;
+
+			std::copy(word.begin(), word.end(), chars.begin() + end);
+			offsets[kept++] = end;
+			end += std::uint32_t(word.size());
+		}
+		offsets[kept] = end;
+		offsets.resize(kept + 1);
+		chars.resize(end);
 	}
 
 };
@@ -29,23 +214,47 @@ public:
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
 /*
-	Holds a collection of Pointers to Words.
+	Holds a collection of Indices of Words in a Dictionary.
 	Its purpose is to be Dictionary that is cheaper/faster to copy around and remove elements from.
 */
-class DictionaryView : public std::vector<const std::string*>
+class DictionaryView : public std::pmr::vector<WordID>
 {
+private: // Variables
+
+	// The Dictionary that the indices refer to.
+	const Dictionary* source;
+
 public:
 
-	// Constructs a DictionaryView of pointers to the elements in the given Dictionary.
-	inline DictionaryView(const Dictionary& dict)
+	// Constructs a DictionaryView of every word in the given Dictionary (with its indices in the given memory resource).
+	inline DictionaryView(const Dictionary& dict, std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+		:
+		std::pmr::vector<WordID>(dict.size(), resource), source{ &dict }
 	{
-		this->reserve(dict.size());
-		for (const auto& elem : dict)
+		for (std::size_t i{}; i < dict.size(); ++i)
 		{
-			this->push_back(&elem);
+			(*this)[i] = static_cast<WordID>(i);
 		}
 	}
 
+	// Returns the Dictionary that the indices refer to.
+	inline const Dictionary& dictionary() const noexcept
+	{
+		return *source;
+	}
+
+	// Returns the number of bytes that the indices take up.
+	inline std::size_t memory_usage() const noexcept
+	{
+		return capacity() * sizeof(WordID);
+	}
+
+	// Returns the word with the given index.
+	inline std::string_view word(const WordID id) const noexcept
+	{
+		return (*source)[id];
+	}
+
 	// Erases the words that meet the given condition from the dictionary.
 	template<class Predicate>
 	inline void erase_if(Predicate&& condition)
@@ -69,8 +278,32 @@ inline constexpr std::size_t any_length{ 0 };
 
 // ================================================================================================================================ //
 
-// Attempts to load a Dictionary from the given file.
-Dictionary load_dictionary(const char* const filename, const std::size_t word_length = any_length, const bool allow_empty = false);
+// Paths of the Dictionary files that come with the program (these are the files that can be embedded in it).
+inline constexpr const char* wordle_answers_file{ "../Dictionaries/wordle-answers.txt" };
+inline constexpr const char* wordle_guesses_file{ "../Dictionaries/wordle-guesses.txt" };
+inline constexpr const char* scrabble_file{ "../Dictionaries/scrabble-dict.txt" };
+
+inline constexpr const char* builtin_dictionary_files[]{ wordle_answers_file, wordle_guesses_file, scrabble_file };
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Builds a Dictionary from the words in the given text (separated by whitespace), with the same rules as reading them from a file.
+// The words are UTF-8, and are stored in the codes of the given Alphabet (which must hold every letter of the words that are kept).
+// Without one, the Alphabet is made of the letters of every word in the text (of any length), so every length of a text shares it.
+Dictionary parse_dictionary(const std::string_view text, const std::size_t word_length = any_length, const bool allow_empty = false,
+	const std::shared_ptr<const Alphabet>& alphabet = nullptr);
+
+// Reads a Dictionary from the given file (always from the file, even if the program has an embedded copy of it).
+Dictionary read_dictionary(const char* const filename, const std::size_t word_length = any_length, const bool allow_empty = false,
+	const std::shared_ptr<const Alphabet>& alphabet = nullptr);
+
+// Loads a Dictionary from the embedded copy of the given file if the program has one, or else reads it from the file.
+Dictionary load_dictionary(const char* const filename, const std::size_t word_length = any_length, const bool allow_empty = false,
+	const std::shared_ptr<const Alphabet>& alphabet = nullptr);
+
+// Returns the Alphabet of every file of the Dictionary Type (built the first time that it is needed), which both of its
+// Dictionaries are stored in, so that any answer can be compared with any guess.
+const std::shared_ptr<const Alphabet>& dictionary_alphabet(const DictType type);
 
 // Loads a Dictionary of Words that can be chosen as the Answer.
 Dictionary load_answers(const DictType type, const std::size_t word_length = any_length, const bool allow_empty = false);
@@ -78,12 +311,21 @@ Dictionary load_answers(const DictType type, const std::size_t word_length = any
 // Loads a Dictionary of Words that are valid guesses.
 Dictionary load_guesses(const DictType type, const std::size_t word_length = any_length, const bool allow_empty = false);
 
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Throws if the two Dictionaries are not stored in the codes of the same Alphabet (as their words could not be compared).
+void require_same_alphabet(const Dictionary& answers, const Dictionary& guesses);
+
 // ================================================================================================================================ //
 
 // Picks a random word from the dictionary.
 std::string pick_word(const Dictionary& dict);
 
-// Verifies that the word is actually in the dictionary before returning it.
+// Returns a random subset of the given number of words (kept in their original order).
+Dictionary sample_words(const Dictionary& dict, const std::size_t count);
+
+// Verifies that the word is actually in the (sorted) dictionary before returning it.
+// A single check is cheaper with a binary search than building a WordSet for it.
 const std::string& pick_word(const Dictionary& dict, const std::string& word);
 
 // ================================================================================================================================ //
@@ -0,0 +1,171 @@
+#include "Embedded.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// This Macro can be set externally with compilation flags (the source that it includes is written by the "embed" command).
+#ifdef EMBED_DICTIONARIES
+#  include "EmbeddedDictionaries.inc"
+#endif
+
+// ================================================================================================================================ //
+
+const EmbeddedDictionary* find_embedded(const std::string_view filename) noexcept
+{
+#ifdef EMBED_DICTIONARIES
+	for (const EmbeddedDictionary& embedded : embedded_dictionaries)
+	{
+		if (filename == embedded.filename)
+			return &embedded;
+	}
+#else
+	static_cast<void>(filename);
+#endif
+	return nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns every word of a bucket (as views into the embedded data).
+static std::vector<std::string_view> bucket_words(const EmbeddedBucket& bucket)
+{
+	std::vector<std::string_view> words{};
+	words.reserve(bucket.count);
+
+	for (std::size_t c{}; c < bucket.chunk_count; ++c)
+	{
+		const std::string_view chunk{ bucket.chunks[c] };
+		for (std::size_t i{}; i + bucket.length <= chunk.size(); i += bucket.length)
+			words.push_back(chunk.substr(i, bucket.length));
+	}
+	return words;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Dictionary load_embedded(const EmbeddedDictionary& embedded, const std::size_t word_length)
+{
+	Dictionary dict{};
+
+	if (word_length != any_length)
+	{
+		for (std::size_t b{}; b < embedded.bucket_count; ++b)
+		{
+			const EmbeddedBucket& bucket{ embedded.buckets[b] };
+			if (bucket.length != word_length) continue;
+
+			dict.reserve(bucket.count, bucket.count * bucket.length);
+			for (const std::string_view word : bucket_words(bucket))
+				dict.push_back(word);
+		}
+		return dict;
+	}
+
+	// Every bucket is already sorted, so the whole Dictionary is the buckets merged in the embedded order.
+	std::vector<std::vector<std::string_view>> buckets{};
+	std::vector<std::size_t> next(embedded.bucket_count);
+	std::size_t words{};
+	std::size_t chars{};
+
+	for (std::size_t b{}; b < embedded.bucket_count; ++b)
+	{
+		buckets.push_back(bucket_words(embedded.buckets[b]));
+		words += embedded.buckets[b].count;
+		chars += embedded.buckets[b].count * embedded.buckets[b].length;
+	}
+
+	dict.reserve(words, chars);
+	for (std::size_t c{}; c < embedded.order_count; ++c)
+	{
+		for (const char bucket : embedded.order[c])
+		{
+			const std::size_t b{ std::size_t(bucket - 'a') };
+			dict.push_back(buckets[b][next[b]++]);
+		}
+	}
+	return dict;
+}
+
+// ================================================================================================================================ //
+
+void write_embedded(const std::string& filename)
+{
+	// The letters of each bucket are split into literals of about this many characters.
+	constexpr std::size_t chunk_size{ 4096 };
+
+	std::ofstream file{ filename };
+	if (!file)
+		throw std::runtime_error("Unable to open output file.");
+
+	file << "// Generated by the \"embed\" command from the Dictionary files (do not edit).\n";
+	file << "// Compile the program with EMBED_DICTIONARIES defined to use it.\n";
+
+	std::vector<std::string> entries{};
+	for (const char* const path : builtin_dictionary_files)
+	{
+		const Dictionary dict{ read_dictionary(path) };
+
+		// The name of each array is made from the name of the file (e.g. "wordle-answers.txt" becomes "wordle_answers").
+		std::string name{ path };
+		name = name.substr(name.find_last_of('/') + 1);
+		name = name.substr(0, name.find('.'));
+		std::replace(name.begin(), name.end(), '-', '_');
+
+		std::vector<std::string> buckets{};
+		std::vector<std::size_t> bucket_of_length(1);
+		for (std::size_t length{ 1 }, done{}; done < dict.size(); ++length)
+		{
+			std::vector<std::string_view> words{};
+			std::copy_if(dict.begin(), dict.end(), std::back_inserter(words), [=](const std::string_view word) { return word.size() == length; });
+
+			bucket_of_length.push_back(buckets.size());
+			if (words.empty()) continue;
+
+			const std::string array{ name + '_' + std::to_string(length) };
+			const std::size_t words_per_chunk{ std::max<std::size_t>(1, chunk_size / length) };
+
+			file << "\nstatic constexpr std::string_view " << array << "[]{\n";
+			for (std::size_t i{}; i < words.size(); i += words_per_chunk)
+			{
+				file << "\t\"";
+				for (std::size_t w{ i }; w < std::min(words.size(), i + words_per_chunk); ++w)
+					file << words[w];
+				file << "\",\n";
+			}
+			file << "};\n";
+
+			buckets.push_back("\t{ " + std::to_string(length) + ", " + std::to_string(words.size()) + ", " + array + ", std::size(" + array + ") },\n");
+			done += words.size();
+		}
+
+		file << "\nstatic constexpr EmbeddedBucket " << name << "_buckets[]{\n";
+		for (const std::string& bucket : buckets)
+			file << bucket;
+		file << "};\n";
+
+		file << "\nstatic constexpr std::string_view " << name << "_order[]{\n";
+		for (std::size_t i{}; i < dict.size(); i += chunk_size)
+		{
+			file << "\t\"";
+			for (std::size_t w{ i }; w < std::min(dict.size(), i + chunk_size); ++w)
+				file << char('a' + bucket_of_length[dict[w].size()]);
+			file << "\",\n";
+		}
+		file << "};\n";
+
+		entries.push_back("\t{ \"" + std::string(path) + "\", " + name + "_buckets, std::size(" + name + "_buckets), " + name + "_order, std::size(" + name + "_order) },\n");
+	}
+
+	file << "\nstatic constexpr EmbeddedDictionary embedded_dictionaries[]{\n";
+	for (const std::string& entry : entries)
+		file << entry;
+	file << "};\n";
+
+	if (!file)
+		throw std::runtime_error("Unable to write output file.");
+}
+
+// ================================================================================================================================ //
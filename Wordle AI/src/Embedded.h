@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <string_view>
+
+#include "Dictionary.h"
+
+// ================================================================================================================================ //
+
+/*
+	The words of one length in an embedded Dictionary.
+	Every word in a bucket has the same length, so they are stored back-to-back without any offsets (word i starts at i * length).
+	The letters are split into chunks of whole words, since some compilers limit the length of a single string literal.
+*/
+struct EmbeddedBucket
+{
+	std::size_t length;
+	std::size_t count;
+
+	const std::string_view* chunks;
+	std::size_t chunk_count;
+};
+
+// A Dictionary file that was compiled into the program (sorted, and bucketed by length).
+struct EmbeddedDictionary
+{
+	// The path that the Dictionary was loaded from (load_dictionary() is given the same path).
+	const char* filename;
+
+	// Buckets in order of increasing length.
+	const EmbeddedBucket* buckets;
+	std::size_t bucket_count;
+
+	// [Word in sorted order] -> 'a' + Index of the bucket of the word (in chunks, like the letters of a bucket).
+	// This merges the buckets back into the order of the whole Dictionary without comparing any words.
+	const std::string_view* order;
+	std::size_t order_count;
+};
+
+// ================================================================================================================================ //
+
+// Returns the embedded copy of the Dictionary file, or nullptr if the program was not built with EMBED_DICTIONARIES (or does not hold it).
+const EmbeddedDictionary* find_embedded(const std::string_view filename) noexcept;
+
+// Copies the words of the given length (or of every length, in sorted order) out of an embedded Dictionary.
+Dictionary load_embedded(const EmbeddedDictionary& embedded, const std::size_t word_length);
+
+// Writes the source that embeds the built-in Dictionary files (to be compiled with EMBED_DICTIONARIES).
+void write_embedded(const std::string& filename);
+
+// ================================================================================================================================ //
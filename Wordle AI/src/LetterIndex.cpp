@@ -0,0 +1,120 @@
+#include "LetterIndex.h"
+
+#include <algorithm>
+
+// ================================================================================================================================ //
+
+LetterIndex::LetterIndex(const Dictionary& dict, std::pmr::memory_resource* const resource)
+	:
+	dict{ dict }, positions{ resource }, counts(dict.alphabet().size(), resource), lengths{ resource }, none(dict.size(), false, resource)
+{
+	// Every set is built in place (a copy of a set would be made in the default resource).
+	const auto empty_set = [&]() { return Bitset(dict.size(), false, resource); };
+
+	for (std::size_t id{}; id < dict.size(); ++id)
+	{
+		const std::string_view word{ dict[id] };
+
+		while (positions.size() < word.size())
+		{
+			std::pmr::vector<Bitset>& letters{ positions.emplace_back() };
+			letters.reserve(counts.size());
+			for (std::size_t letter{}; letter < counts.size(); ++letter)
+				letters.push_back(empty_set());
+		}
+
+		while (lengths.size() <= word.size())
+			lengths.push_back(empty_set());
+
+		lengths[word.size()].set(id);
+
+		for (std::size_t i{}; i < word.size(); ++i)
+		{
+			const std::size_t letter{ letter_index(word[i]) };
+
+			positions[i][letter].set(id);
+
+			// Occurrences of the letter before this one (words are short, so this is cheaper than counts for the whole alphabet).
+			const auto occurrences{ std::size_t(std::count(word.begin(), word.begin() + std::ptrdiff_t(i), word[i])) };
+
+			std::pmr::vector<Bitset>& letter_counts{ counts[letter] };
+			if (letter_counts.size() <= occurrences)
+				letter_counts.push_back(empty_set());
+
+			letter_counts[occurrences].set(id);
+		}
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t LetterIndex::memory_usage() const noexcept
+{
+	const auto sets_usage = [](const std::pmr::vector<Bitset>& sets)
+	{
+		std::size_t bytes{ sets.capacity() * sizeof(Bitset) };
+		for (const Bitset& set : sets)
+			bytes += set.memory_usage();
+		return bytes;
+	};
+
+	std::size_t bytes{ sets_usage(lengths) + none.memory_usage() };
+	for (const auto* const table : { &positions, &counts })
+	{
+		bytes += table->capacity() * sizeof(std::pmr::vector<Bitset>);
+		for (const std::pmr::vector<Bitset>& sets : *table)
+			bytes += sets_usage(sets);
+	}
+	return bytes;
+}
+
+// ================================================================================================================================ //
+
+const Bitset& LetterIndex::with_length(const std::size_t length) const noexcept
+{
+	return (length < lengths.size()) ? lengths[length] : none;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Bitset LetterIndex::matching(const Results& feedback) const
+{
+	Bitset words(dict.size(), true);
+	filter(feedback, words);
+	return words;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void LetterIndex::filter(const Results& feedback, Bitset& words) const
+{
+	for_each_constraint(feedback, [&](const Bitset& set, const bool required)
+	{
+		if (required)
+			words &= set;
+		else
+			words.and_not(set);
+	});
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+const Bitset& LetterIndex::at_position(const std::size_t position, const char letter) const noexcept
+{
+	const std::size_t i{ letter_index(letter) };
+	return (position < positions.size() && i < counts.size()) ? positions[position][i] : none;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+const Bitset& LetterIndex::at_least(const char letter, const std::size_t count) const noexcept
+{
+	const std::size_t i{ letter_index(letter) };
+	if (i >= counts.size())
+		return none;
+
+	const std::pmr::vector<Bitset>& letter_counts{ counts[i] };
+	return (count <= letter_counts.size()) ? letter_counts[count - 1] : none;
+}
+
+// ================================================================================================================================ //
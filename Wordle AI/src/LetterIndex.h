@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+
+#include <vector>
+#include <string>
+#include <memory_resource>
+
+#include "Bitset.h"
+#include "Dictionary.h"
+#include "WordleSim.h"
+
+// ================================================================================================================================ //
+
+/*
+	An Inverted Index of a Dictionary, mapping letters to the sets of words (by index) that contain them.
+	It holds a Bitset for every (Position, Letter) and for every (Letter, Minimum Count), so that the words
+	that are consistent with some Feedback can be found with a few AND/AND-NOT operations over whole sets.
+
+	It never changes after being built, so one index can be shared by every game that uses the same Dictionary
+	(and every set can be placed in a memory resource of its own, such as the huge pages of a NUMA node).
+*/
+class LetterIndex
+{
+private: // Variables
+
+	// The indexed Dictionary.
+	const Dictionary& dict;
+
+	// [Position][Letter Index] -> Words with the Letter at the Position.
+	std::pmr::vector<std::pmr::vector<Bitset>> positions;
+
+	// [Letter Index][Count - 1] -> Words with at least Count occurrences of the Letter (one entry per letter of the Alphabet).
+	std::pmr::vector<std::pmr::vector<Bitset>> counts;
+
+	// [Length] -> Words of the Length.
+	std::pmr::vector<Bitset> lengths;
+
+	// Set of no words (for counts that no word reaches).
+	Bitset none;
+
+public: // Functions
+
+	// Builds the index for the given Dictionary (which must outlive the index), in the given memory resource.
+	LetterIndex(const Dictionary& dict, std::pmr::memory_resource* const resource = std::pmr::get_default_resource());
+
+	// Returns the set of words that are consistent with the Feedback (the same rules as WordleAI::updateDictionary()).
+	Bitset matching(const Results& feedback) const;
+
+	// Removes the words that are not consistent with the Feedback from the given set (which must be the size of the Dictionary).
+	void filter(const Results& feedback, Bitset& words) const;
+
+	// Calls function(set, required) with every set that the words consistent with the Feedback must be in (or must not be in).
+	// filter() applies these sets to a whole Bitset; a single word can be tested against them instead.
+	template<class Function>
+	inline void for_each_constraint(const Results& feedback, Function&& function) const
+	{
+		for (std::size_t i{}; i < feedback.size(); ++i)
+		{
+			const Feedback f{ feedback[i] };
+			const char letter{ f.letter };
+			const Result result{ f.result };
+
+			// Number of non-invalid occurrences of the current letter in the guess.
+			std::size_t count{};
+			for (const Feedback fb : feedback)
+			{
+				if ((fb.letter == letter) && (fb.result != Result::Invalid))
+					++count;
+			}
+
+			function(at_position(i, letter), result == Result::Correct);
+
+			if (count != 0)
+				function(at_least(letter, count), true);
+
+			// Invalid letters also give the exact number of occurrences.
+			if (result == Result::Invalid)
+				function(at_least(letter, count + 1), false);
+		}
+	}
+
+	// Returns the words of the given length.
+	const Bitset& with_length(const std::size_t length) const noexcept;
+
+	// Returns the indexed Dictionary.
+	inline const Dictionary& dictionary() const noexcept
+	{
+		return dict;
+	}
+
+	// Returns the number of bytes that the sets take up.
+	std::size_t memory_usage() const noexcept;
+
+private: // Helper Functions
+
+	// Returns the words with the Letter at the Position.
+	const Bitset& at_position(const std::size_t position, const char letter) const noexcept;
+
+	// Returns the words with at least Count occurrences of the Letter (Count must not be 0).
+	const Bitset& at_least(const char letter, const std::size_t count) const noexcept;
+
+};
+
+// ================================================================================================================================ //
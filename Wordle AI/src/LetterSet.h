@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <algorithm>
+
+// ================================================================================================================================ //
+
+/*
+	A set of letters (by their index in an Alphabet), stored as Words 64-bit masks.
+
+	LetterMask is the fast path: an alphabet of up to 64 letters (English, and every other Latin, Greek or Cyrillic alphabet) fits in a
+	single mask, so every operation is one bitwise instruction. LetterSet can hold the letters of any Alphabet, and is the generic path
+	for larger alphabets (and the type that letters are stored in between guesses).
+*/
+template<std::size_t Words>
+class BasicLetterSet
+{
+public: // Data Structures
+
+	// Type of each mask.
+	using Mask = std::uint64_t;
+
+	// The number of letters that the set can hold.
+	static constexpr std::size_t capacity{ Words * 64 };
+
+private: // Variables
+
+	std::array<Mask, Words> masks;
+
+public: // Functions
+
+	// Constructs an empty set.
+	constexpr BasicLetterSet() noexcept : masks{} {}
+
+	// Constructs a set with the letters of another set that fit in this one.
+	template<std::size_t Other>
+	inline explicit BasicLetterSet(const BasicLetterSet<Other>& other) noexcept
+		:
+		masks{}
+	{
+		for (std::size_t i{}; i < std::min(Words, Other); ++i)
+			masks[i] = other.mask(i);
+	}
+
+
+	// Returns true if the set holds the letter.
+	inline bool contains(const std::size_t letter) const noexcept
+	{
+		if constexpr (Words == 1)
+			return (masks[0] >> letter) & 1;
+		else
+			return (masks[letter / 64] >> (letter % 64)) & 1;
+	}
+
+	// Adds the letter to the set.
+	inline void insert(const std::size_t letter) noexcept
+	{
+		if constexpr (Words == 1)
+			masks[0] |= Mask{ 1 } << letter;
+		else
+			masks[letter / 64] |= Mask{ 1 } << (letter % 64);
+	}
+
+	// Removes the letter from the set.
+	inline void erase(const std::size_t letter) noexcept
+	{
+		if constexpr (Words == 1)
+			masks[0] &= ~(Mask{ 1 } << letter);
+		else
+			masks[letter / 64] &= ~(Mask{ 1 } << (letter % 64));
+	}
+
+	// Removes every letter from the set.
+	inline void clear() noexcept
+	{
+		masks.fill(0);
+	}
+
+	// Returns true if the set holds no letters.
+	inline bool empty() const noexcept
+	{
+		return std::all_of(masks.begin(), masks.end(), [](const Mask mask) { return mask == 0; });
+	}
+
+	// Returns a set of every letter that the set can hold.
+	static inline BasicLetterSet all() noexcept
+	{
+		BasicLetterSet set{};
+		set.masks.fill(~Mask{});
+		return set;
+	}
+
+	// Returns the mask at index i.
+	inline Mask mask(const std::size_t i) const noexcept
+	{
+		return masks[i];
+	}
+
+
+	inline bool operator==(const BasicLetterSet& other) const noexcept
+	{
+		return masks == other.masks;
+	}
+
+	inline bool operator!=(const BasicLetterSet& other) const noexcept
+	{
+		return masks != other.masks;
+	}
+
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// The letters of an alphabet of up to 64 letters, in a single mask.
+using LetterMask = BasicLetterSet<1>;
+
+// The letters of any Alphabet (see max_letters in Alphabet.h).
+using LetterSet = BasicLetterSet<3>;
+
+// ================================================================================================================================ //
@@ -0,0 +1,183 @@
+#include "Memory.h"
+
+#include <sstream>
+#include <iomanip>
+
+// The peak resident set size is read from the OS.
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#  include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#  include <sys/resource.h>
+#endif
+
+// ================================================================================================================================ //
+
+std::string subsystem_name(const Subsystem subsystem)
+{
+	switch (subsystem)
+	{
+	case Subsystem::Dictionaries: return "dictionaries";
+	case Subsystem::Games:        return "games";
+	case Subsystem::Caches:       return "caches";
+	}
+	return "invalid";
+}
+
+// ================================================================================================================================ //
+
+MemoryLedger::MemoryLedger() noexcept
+	:
+	accounts{}, total{}, peak_total{}, budget{}
+{}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void MemoryLedger::add(const Subsystem subsystem, const std::size_t bytes) noexcept
+{
+	Account& account{ accounts[std::size_t(subsystem)] };
+	raise(account.peak, account.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+	raise(peak_total, total.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool MemoryLedger::try_add(const Subsystem subsystem, const std::size_t bytes) noexcept
+{
+	// The total is only raised if it stays within the budget, so two caches cannot both take the last of it.
+	const std::size_t limit{ budget.load(std::memory_order_relaxed) };
+	std::size_t current{ total.load(std::memory_order_relaxed) };
+	do
+	{
+		if (limit != 0 && current + bytes > limit)
+			return false;
+	}
+	while (!total.compare_exchange_weak(current, current + bytes, std::memory_order_relaxed));
+
+	raise(peak_total, current + bytes);
+
+	Account& account{ accounts[std::size_t(subsystem)] };
+	raise(account.peak, account.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void MemoryLedger::remove(const Subsystem subsystem, const std::size_t bytes) noexcept
+{
+	accounts[std::size_t(subsystem)].bytes.fetch_sub(bytes, std::memory_order_relaxed);
+	total.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+// ================================================================================================================================ //
+
+void MemoryLedger::set_budget(const std::size_t bytes) noexcept
+{
+	budget.store(bytes, std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void MemoryLedger::reset_peaks() noexcept
+{
+	for (Account& account : accounts)
+		account.peak.store(account.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	peak_total.store(total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+MemoryLedger::Report MemoryLedger::report() const noexcept
+{
+	Report report{};
+	for (std::size_t i{}; i < subsystem_count; ++i)
+	{
+		report.bytes[i] = accounts[i].bytes.load(std::memory_order_relaxed);
+		report.peaks[i] = accounts[i].peak.load(std::memory_order_relaxed);
+	}
+	report.peak_total = peak_total.load(std::memory_order_relaxed);
+	report.budget = budget.load(std::memory_order_relaxed);
+	return report;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void MemoryLedger::raise(std::atomic<std::size_t>& peak, const std::size_t value) noexcept
+{
+	std::size_t current{ peak.load(std::memory_order_relaxed) };
+	while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+MemoryLedger& memory_ledger() noexcept
+{
+	static MemoryLedger ledger{};
+	return ledger;
+}
+
+// ================================================================================================================================ //
+
+MemoryCharge::MemoryCharge(const Subsystem subsystem, const std::size_t bytes) noexcept
+	:
+	subsystem{ subsystem }, bytes{ bytes }
+{
+	memory_ledger().add(subsystem, bytes);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+MemoryCharge::~MemoryCharge()
+{
+	memory_ledger().remove(subsystem, bytes);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void MemoryCharge::update(const std::size_t new_bytes) noexcept
+{
+	// The new bytes are added before the old ones are removed, so the peak never misses a moment where both are held.
+	memory_ledger().add(subsystem, new_bytes);
+	memory_ledger().remove(subsystem, bytes);
+	bytes = new_bytes;
+}
+
+// ================================================================================================================================ //
+
+std::size_t peak_rss()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters{};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return std::size_t(counters.PeakWorkingSetSize);
+	return 0;
+#elif defined(__unix__) || defined(__APPLE__)
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+
+	// Linux reports kilobytes, and macOS reports bytes.
+#  if defined(__APPLE__)
+	return std::size_t(usage.ru_maxrss);
+#  else
+	return std::size_t(usage.ru_maxrss) << 10;
+#  endif
+#else
+	return 0;
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::string format_bytes(const std::size_t bytes)
+{
+	std::ostringstream text{};
+	text << std::fixed << std::setprecision(2) << (double(bytes) / double(1 << 20)) << " MB";
+	return text.str();
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+
+#include <array>
+#include <atomic>
+#include <string>
+
+// ================================================================================================================================ //
+
+// The parts of the program that memory is accounted to.
+enum class Subsystem
+{
+	Dictionaries, // Dictionaries, their views and their indices (everything that is loaded once and then only read).
+	Games,        // The state of the solver in every game that is being played.
+	Caches        // Caches that can give up memory and still work (the Pattern Cache and the Solver's Transposition Table).
+};
+
+// The number of subsystems.
+inline constexpr std::size_t subsystem_count{ 3 };
+
+// Returns the name of the subsystem (as it is written to reports).
+std::string subsystem_name(const Subsystem subsystem);
+
+// ================================================================================================================================ //
+
+/*
+	Counts the bytes that each subsystem holds (and the most that it has held), and enforces a global memory budget.
+
+	Dictionaries and game state are always added, as the program cannot run without them, but they still count against the budget.
+	Caches only grow with try_add(), which fails once the total would pass the budget, so a cache that is refused memory has to
+	evict or skip an entry instead. The counts are relaxed atomics, so any thread may add to them at any time.
+
+	Every subsystem reports the bytes of its own structures (the sizes of their buffers), so the totals leave out the overhead of
+	the allocator and the memory of the program itself: compare them to peak_rss() for the full footprint.
+*/
+class MemoryLedger
+{
+public: // Data Structures
+
+	// The bytes held by each subsystem, and the most that each has held.
+	struct Report
+	{
+		std::array<std::size_t, subsystem_count> bytes;
+		std::array<std::size_t, subsystem_count> peaks;
+
+		// The most that every subsystem has held at once, and the budget (0 if there is none).
+		std::size_t peak_total;
+		std::size_t budget;
+	};
+
+private: // Data Structures
+
+	struct Account
+	{
+		std::atomic<std::size_t> bytes;
+		std::atomic<std::size_t> peak;
+	};
+
+private: // Variables
+
+	std::array<Account, subsystem_count> accounts;
+
+	std::atomic<std::size_t> total;
+	std::atomic<std::size_t> peak_total;
+
+	// The most bytes that every subsystem may hold at once (0 for no limit).
+	std::atomic<std::size_t> budget;
+
+public: // Functions
+
+	MemoryLedger() noexcept;
+
+	// Adds bytes to the subsystem (even if the total passes the budget).
+	void add(const Subsystem subsystem, const std::size_t bytes) noexcept;
+
+	// Adds bytes to the subsystem if the total stays within the budget (returns false, and adds nothing, if it would not).
+	bool try_add(const Subsystem subsystem, const std::size_t bytes) noexcept;
+
+	// Removes bytes that were added to the subsystem.
+	void remove(const Subsystem subsystem, const std::size_t bytes) noexcept;
+
+
+	// Sets the budget in bytes (0 removes it). Memory that is already held is kept, even if it is over the new budget.
+	void set_budget(const std::size_t bytes) noexcept;
+
+	// Starts measuring the peaks again from the bytes that are held now.
+	void reset_peaks() noexcept;
+
+	// Returns the bytes held by every subsystem and their peaks.
+	Report report() const noexcept;
+
+private: // Helper Functions
+
+	// Raises the peak to the value if it is higher.
+	static void raise(std::atomic<std::size_t>& peak, const std::size_t value) noexcept;
+
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the ledger of the whole process.
+MemoryLedger& memory_ledger() noexcept;
+
+// ================================================================================================================================ //
+
+/*
+	Holds bytes in a subsystem of the ledger for as long as it exists (for structures whose size is known once they are built).
+*/
+class MemoryCharge
+{
+private: // Variables
+
+	const Subsystem subsystem;
+	std::size_t bytes;
+
+public: // Functions
+
+	// Adds the bytes to the subsystem.
+	MemoryCharge(const Subsystem subsystem, const std::size_t bytes = 0) noexcept;
+
+	// Removes the bytes from the subsystem.
+	~MemoryCharge();
+
+	MemoryCharge(const MemoryCharge&) = delete;
+	MemoryCharge& operator=(const MemoryCharge&) = delete;
+
+	// Changes the number of bytes that are held.
+	void update(const std::size_t new_bytes) noexcept;
+
+};
+
+// ================================================================================================================================ //
+
+// Returns the most memory that the process has held in RAM at once (its peak resident set size), or 0 if it is not known.
+std::size_t peak_rss();
+
+// Formats a number of bytes in megabytes (such as "12.34 MB").
+std::string format_bytes(const std::size_t bytes);
+
+// ================================================================================================================================ //
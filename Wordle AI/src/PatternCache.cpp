@@ -0,0 +1,206 @@
+#include "PatternCache.h"
+#include "Memory.h"
+
+#include <mutex>
+#include <algorithm>
+
+// ================================================================================================================================ //
+
+// Returns the bytes that the Patterns of the longest word of the Dictionary are stored in.
+static std::size_t pattern_width_of(const Dictionary& words) noexcept
+{
+	std::size_t length{};
+	for (std::size_t i{}; i < words.size(); ++i)
+		length = std::max(length, words[i].size());
+
+	return PatternCache::pattern_width(length);
+}
+
+// ================================================================================================================================ //
+
+PatternCache::PatternCache(const Dictionary& guesses, const Dictionary& answers, const std::size_t budget, const std::size_t tile_size)
+	:
+	guesses{ guesses }, answers{ answers }, tile_size{ std::max<std::size_t>(tile_size, 1) }, pattern_width_bytes{ pattern_width_of(answers) },
+	tile_columns{ (answers.size() + this->tile_size - 1) / this->tile_size },
+	capacity{ std::max<std::size_t>(budget / (this->tile_size * this->tile_size * pattern_width_bytes), 1) },
+	tile_bytes{ sizeof(Tile) + this->tile_size * this->tile_size * pattern_width_bytes + sizeof(std::unique_ptr<Tile>) + sizeof(std::pair<const std::uint64_t, std::size_t>) + 2 * sizeof(void*) },
+	tiles{}, slots{}, hand{}, mutex{}, hits{}, misses{}, evictions{}
+{
+	require_same_alphabet(answers, guesses);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+PatternCache::~PatternCache()
+{
+	memory_ledger().remove(Subsystem::Caches, tiles.size() * tile_bytes);
+}
+
+// ================================================================================================================================ //
+
+Pattern PatternCache::get(const WordID guess, const WordID answer)
+{
+	const std::uint64_t key{ tile_key(guess, answer) };
+
+	{
+		const std::shared_lock lock{ mutex };
+		if (const Tile* const tile{ find(key) })
+		{
+			++hits;
+			return read(*tile, guess, answer);
+		}
+	}
+
+	++misses;
+	load(key);
+
+	const std::shared_lock lock{ mutex };
+	const Tile* const tile{ find(key) };
+
+	// The Tile can only be gone already if other threads filled the whole cache in the meantime.
+	return tile ? read(*tile, guess, answer) : compute(guess, answer);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void PatternCache::get_row(const WordID guess, const WordID* const first, const WordID* const last, std::vector<Pattern>& patterns)
+{
+	patterns.resize(std::size_t(last - first));
+
+	std::uint64_t row_hits{};
+	std::uint64_t row_misses{};
+
+	std::shared_lock lock{ mutex };
+
+	const Tile* tile{ nullptr };
+	std::uint64_t current{ ~std::uint64_t{} };
+
+	for (std::size_t i{}; i < patterns.size(); ++i)
+	{
+		const WordID answer{ first[i] };
+		const std::uint64_t key{ tile_key(guess, answer) };
+
+		if (key != current)
+		{
+			current = key;
+			tile = find(key);
+
+			if (tile)
+			{
+				++row_hits;
+			}
+			else
+			{
+				++row_misses;
+				lock.unlock();
+				load(key);
+				lock.lock();
+				tile = find(key);
+			}
+		}
+
+		patterns[i] = tile ? read(*tile, guess, answer) : compute(guess, answer);
+	}
+
+	hits += row_hits;
+	misses += row_misses;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t PatternCache::pattern_width(const std::size_t word_length) noexcept
+{
+	const Pattern largest{ pattern_count(word_length) - 1 };
+	return (largest <= 0xFF) ? 1 : (largest <= 0xFFFF) ? 2 : 4;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+PatternCache::Statistics PatternCache::statistics() const
+{
+	const std::shared_lock lock{ mutex };
+	return { hits, misses, evictions, tiles.size(), capacity, tiles.size() * tile_bytes };
+}
+
+// ================================================================================================================================ //
+
+Pattern PatternCache::compute(const WordID guess, const WordID answer) const noexcept
+{
+	const std::string_view guess_word{ guesses[guess] };
+	const std::string_view answer_word{ answers[answer] };
+
+	return (guess_word.size() == answer_word.size()) ? make_pattern(guess_word, answer_word) : Pattern{};
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+const PatternCache::Tile* PatternCache::find(const std::uint64_t key) const noexcept
+{
+	const auto slot{ slots.find(key) };
+	if (slot == slots.end())
+		return nullptr;
+
+	const Tile* const tile{ tiles[slot->second].get() };
+	// The bit is only written when it changes, so that threads reading the same Tile do not keep taking its cache line from each other.
+	if (!tile->referenced.load(std::memory_order_relaxed))
+		tile->referenced.store(true, std::memory_order_relaxed);
+	return tile;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void PatternCache::load(const std::uint64_t key)
+{
+	// The Tile is computed before taking the lock, so that readers of other Tiles are not blocked by it.
+	auto tile{ std::make_unique<Tile>() };
+	tile->key = key;
+	tile->patterns.resize(tile_size * tile_size * pattern_width_bytes);
+	tile->referenced = true;
+
+	const std::size_t first_guess{ std::size_t(key / tile_columns) * tile_size };
+	const std::size_t first_answer{ std::size_t(key % tile_columns) * tile_size };
+	const std::size_t last_guess{ std::min(first_guess + tile_size, guesses.size()) };
+	const std::size_t last_answer{ std::min(first_answer + tile_size, answers.size()) };
+
+	for (std::size_t g{ first_guess }; g < last_guess; ++g)
+	{
+		std::uint8_t* const row{ tile->patterns.data() + (g - first_guess) * tile_size * pattern_width_bytes };
+
+		for (std::size_t a{ first_answer }; a < last_answer; ++a)
+		{
+			write(row + (a - first_answer) * pattern_width_bytes, compute(WordID(g), WordID(a)));
+		}
+	}
+
+	const std::unique_lock lock{ mutex };
+
+	// Another thread may have loaded the same Tile in the meantime.
+	if (slots.count(key))
+		return;
+
+	if (tiles.size() < capacity && memory_ledger().try_add(Subsystem::Caches, tile_bytes))
+	{
+		slots[key] = tiles.size();
+		tiles.push_back(std::move(tile));
+		return;
+	}
+
+	// The global budget is spent before the first Tile, so the Patterns are computed without the cache.
+	if (tiles.empty())
+		return;
+
+	// CLOCK: Tiles that were read since the hand last passed them get a second chance.
+	while (tiles[hand]->referenced.exchange(false, std::memory_order_relaxed))
+	{
+		hand = (hand + 1) % tiles.size();
+	}
+
+	slots.erase(tiles[hand]->key);
+	slots[key] = hand;
+	tiles[hand] = std::move(tile);
+	hand = (hand + 1) % tiles.size();
+
+	++evictions;
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "Dictionary.h"
+#include "WordleSim.h"
+
+// ================================================================================================================================ //
+
+/*
+	A cache of the Patterns of (Guess, Answer) pairs, for dictionaries that are too large to hold the full matrix in memory.
+
+	The matrix is split into square Tiles (a block of guesses by a block of answers) that are computed on demand.
+	The number of Tiles held at once is bounded by a memory budget; once it is full, Tiles are evicted with the CLOCK policy
+	(every Tile has a reference bit that is set when it is read, and the clock hand evicts the first Tile whose bit is clear).
+	Every Tile is also taken from the global MemoryLedger, so the cache counts as full as soon as the global budget is reached.
+
+	Any number of threads may read from the cache at once; they only wait on each other while a Tile is being inserted.
+*/
+class PatternCache
+{
+public: // Data Structures
+
+	// Counters that describe how well the cache is doing.
+	struct Statistics
+	{
+		// Reads of a Tile that was already in the cache.
+		std::uint64_t hits;
+
+		// Reads of a Tile that had to be computed first.
+		std::uint64_t misses;
+
+		// Tiles that were removed to make room for other Tiles.
+		std::uint64_t evictions;
+
+		// Number of Tiles in the cache (and the most that it can hold).
+		std::size_t tiles;
+		std::size_t capacity;
+
+		// Number of bytes that the Tiles take up.
+		std::size_t bytes;
+
+		// Returns the fraction of reads that were hits.
+		inline double hit_rate() const noexcept
+		{
+			return (hits + misses == 0) ? 0.0 : double(hits) / double(hits + misses);
+		}
+	};
+
+private: // Data Structures
+
+	// A block of Patterns: [Guess - First Guess][Answer - First Answer], each stored in pattern_width_bytes bytes.
+	struct Tile
+	{
+		std::uint64_t key;
+		std::vector<std::uint8_t> patterns;
+		mutable std::atomic<bool> referenced;
+	};
+
+private: // Variables
+
+	// The dictionaries that the guesses and answers are words of.
+	const Dictionary& guesses;
+	const Dictionary& answers;
+
+	// Number of guesses (and of answers) covered by a Tile.
+	const std::size_t tile_size;
+
+	// Bytes that each Pattern is stored in (the pattern_width() of the longest answer).
+	const std::size_t pattern_width_bytes;
+
+	// Number of Tiles needed to cover a row of the matrix.
+	const std::size_t tile_columns;
+
+	// The most Tiles that fit in the memory budget.
+	const std::size_t capacity;
+
+	// The bytes that each Tile takes up (with its slot).
+	const std::size_t tile_bytes;
+
+	// Tiles in the cache, and the slot that each one is held in (by key).
+	std::vector<std::unique_ptr<Tile>> tiles;
+	std::unordered_map<std::uint64_t, std::size_t> slots;
+
+	// Slot that the CLOCK policy checks next.
+	std::size_t hand;
+
+	// Readers hold the lock shared; inserting a Tile holds it exclusively.
+	mutable std::shared_mutex mutex;
+
+	std::atomic<std::uint64_t> hits;
+	std::atomic<std::uint64_t> misses;
+	std::atomic<std::uint64_t> evictions;
+
+public: // Functions
+
+	// Constructs an empty cache that holds no more than budget bytes of Patterns (both dictionaries must outlive the cache).
+	PatternCache(const Dictionary& guesses, const Dictionary& answers, const std::size_t budget, const std::size_t tile_size = 8);
+
+	// Gives the memory of the Tiles back to the global MemoryLedger.
+	~PatternCache();
+
+	PatternCache(const PatternCache&) = delete;
+	PatternCache& operator=(const PatternCache&) = delete;
+
+	// Returns the Pattern for the guess and answer (words of different lengths have no Pattern, and give 0).
+	Pattern get(const WordID guess, const WordID answer);
+
+	// Writes the Pattern of the guess against every answer in [first, last) (in order) to patterns.
+	// Answers in increasing order share Tiles, so each Tile is only looked up once.
+	void get_row(const WordID guess, const WordID* const first, const WordID* const last, std::vector<Pattern>& patterns);
+
+	// Returns the current statistics of the cache.
+	Statistics statistics() const;
+
+	// Returns the fewest bytes that hold every Pattern of words of the given length (1 up to 5 letters, 2 up to 10, and 4 above).
+	static std::size_t pattern_width(const std::size_t word_length) noexcept;
+
+private: // Helper Functions
+
+	// Returns the key of the Tile that holds the guess and answer.
+	inline std::uint64_t tile_key(const WordID guess, const WordID answer) const noexcept
+	{
+		return std::uint64_t(guess / tile_size) * tile_columns + (answer / tile_size);
+	}
+
+	// Returns the Pattern for the guess and answer from the Tile that holds them.
+	inline Pattern read(const Tile& tile, const WordID guess, const WordID answer) const noexcept
+	{
+		const std::uint8_t* const cell{ tile.patterns.data() + ((guess % tile_size) * tile_size + (answer % tile_size)) * pattern_width_bytes };
+
+		switch (pattern_width_bytes)
+		{
+		case 1:
+			return cell[0];
+		case 2:
+			return load_as<std::uint16_t>(cell);
+		default:
+			return load_as<std::uint32_t>(cell);
+		}
+	}
+
+	// Stores the Pattern in the pattern_width_bytes bytes of a Tile at cell.
+	inline void write(std::uint8_t* const cell, const Pattern pattern) const noexcept
+	{
+		switch (pattern_width_bytes)
+		{
+		case 1:
+			cell[0] = std::uint8_t(pattern);
+			break;
+		case 2:
+			store_as<std::uint16_t>(cell, pattern);
+			break;
+		default:
+			store_as<std::uint32_t>(cell, pattern);
+			break;
+		}
+	}
+
+	// Returns the value of type T that is stored at the bytes (which need not be aligned).
+	template<class T>
+	static inline T load_as(const std::uint8_t* const bytes) noexcept
+	{
+		T value;
+		std::memcpy(&value, bytes, sizeof(T));
+		return value;
+	}
+
+	// Stores the value as a T at the bytes (which need not be aligned).
+	template<class T>
+	static inline void store_as(std::uint8_t* const bytes, const Pattern value) noexcept
+	{
+		const T narrow{ T(value) };
+		std::memcpy(bytes, &narrow, sizeof(T));
+	}
+
+	// Computes the Pattern for the guess and answer without the cache.
+	Pattern compute(const WordID guess, const WordID answer) const noexcept;
+
+	// Returns the Tile with the given key (or nullptr if it is not in the cache); the lock must be held.
+	const Tile* find(const std::uint64_t key) const noexcept;
+
+	// Computes the Tile with the given key and inserts it (evicting another Tile if the cache is full).
+	void load(const std::uint64_t key);
+
+};
+
+// ================================================================================================================================ //
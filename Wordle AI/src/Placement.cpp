@@ -0,0 +1,351 @@
+#include "Placement.h"
+
+#include <cctype>
+#include <cstdint>
+
+#include <new>
+#include <atomic>
+#include <thread>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+
+// Pages are mapped and placed with the Linux system calls (libnuma is not needed, as mbind() is called directly).
+#ifdef __linux__
+#  include <sched.h>
+#  include <unistd.h>
+#  include <pthread.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#endif
+
+// ================================================================================================================================ //
+
+// The size of a huge page (the size that x86-64 and most ARM kernels use for transparent huge pages).
+static constexpr std::size_t huge_page_size{ std::size_t{ 2 } << 20 };
+
+// The size of the chunks that a ReadOnlyArena starts with (later chunks grow from it).
+static constexpr std::size_t arena_chunk_size{ huge_page_size - 64 };
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::string page_mode_name(const PageMode mode)
+{
+	switch (mode)
+	{
+	case PageMode::Default:     return "default";
+	case PageMode::Transparent: return "transparent";
+	case PageMode::Explicit:    return "explicit";
+	}
+	return "invalid";
+}
+
+// ================================================================================================================================ //
+
+// Reads a list of CPUs in the form of the kernel's "cpulist" files (such as "0-3,8-11").
+static std::vector<int> parse_cpu_list(const std::string& text)
+{
+	std::vector<int> cpus{};
+	std::istringstream stream{ text };
+	for (std::string range{}; std::getline(stream, range, ',');)
+	{
+		const std::size_t dash{ range.find('-') };
+		try
+		{
+			const int first{ std::stoi(range.substr(0, dash)) };
+			const int last{ dash == std::string::npos ? first : std::stoi(range.substr(dash + 1)) };
+			for (int cpu{ first }; cpu <= last; ++cpu)
+				cpus.push_back(cpu);
+		}
+		catch (const std::exception&)
+		{
+			// A range that cannot be read (such as an empty list) has no CPUs.
+		}
+	}
+	return cpus;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Reads the NUMA nodes from sysfs (leaving out the CPUs that the process may not run on, and the nodes that have none of them).
+static std::vector<NumaNode> read_topology()
+{
+	std::vector<NumaNode> nodes{};
+
+#ifdef __linux__
+	cpu_set_t allowed{};
+	const bool has_affinity{ sched_getaffinity(0, sizeof(allowed), &allowed) == 0 };
+
+	std::error_code error{};
+	for (const auto& entry : std::filesystem::directory_iterator{ "/sys/devices/system/node", error })
+	{
+		const std::string name{ entry.path().filename().string() };
+		if (name.size() <= 4 || name.compare(0, 4, "node") != 0 || !std::all_of(name.begin() + 4, name.end(), [](const char chr) { return std::isdigit(chr); }))
+			continue;
+
+		std::ifstream file{ entry.path() / "cpulist" };
+		std::string list{};
+		std::getline(file, list);
+
+		NumaNode node{ std::stoi(name.substr(4)), {} };
+		for (const int cpu : parse_cpu_list(list))
+		{
+			if (!has_affinity || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)))
+				node.cpus.push_back(cpu);
+		}
+
+		if (!node.cpus.empty())
+			nodes.push_back(std::move(node));
+	}
+
+	std::sort(nodes.begin(), nodes.end(), [](const NumaNode& a, const NumaNode& b) { return a.id < b.id; });
+#endif
+
+	if (nodes.empty())
+	{
+		NumaNode node{ -1, std::vector<int>(std::max(1u, std::thread::hardware_concurrency())) };
+		std::iota(node.cpus.begin(), node.cpus.end(), 0);
+		nodes.push_back(std::move(node));
+	}
+
+	return nodes;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+const std::vector<NumaNode>& numa_nodes()
+{
+	static const std::vector<NumaNode> nodes{ read_topology() };
+	return nodes;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t cpu_count()
+{
+	std::size_t count{};
+	for (const NumaNode& node : numa_nodes())
+		count += node.cpus.size();
+	return count;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::vector<std::vector<int>> pick_cpus(const std::size_t count)
+{
+	const std::vector<NumaNode>& nodes{ numa_nodes() };
+	std::vector<std::vector<int>> cpus(nodes.size());
+
+	std::size_t node{};
+	std::size_t cpu{};
+	for (std::size_t i{}; i < count; ++i)
+	{
+		cpus[node].push_back(nodes[node].cpus[cpu]);
+
+		if (++cpu == nodes[node].cpus.size())
+		{
+			cpu = 0;
+			node = (node + 1) % nodes.size();
+		}
+	}
+	return cpus;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t huge_page_bytes()
+{
+	std::ifstream file{ "/proc/self/smaps_rollup" };
+	for (std::string line{}; std::getline(file, line);)
+	{
+		// The line is "AnonHugePages: <Size> kB".
+		std::istringstream stream{ line };
+		std::string name{};
+		std::size_t kilobytes{};
+		if (stream >> name >> kilobytes && name == "AnonHugePages:")
+			return kilobytes << 10;
+	}
+	return 0;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+#ifndef NO_MULTITHREADING
+// Pins the calling thread to the CPU (a CPU that the thread may not run on is ignored, as pinning is only a hint).
+static void pin_thread(const int cpu)
+{
+#ifdef __linux__
+	cpu_set_t set{};
+	CPU_ZERO(&set);
+	if (cpu >= 0 && cpu < CPU_SETSIZE)
+	{
+		CPU_SET(cpu, &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	}
+#else
+	static_cast<void>(cpu);
+#endif
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void run_pinned(const std::vector<std::vector<int>>& cpus, const std::vector<std::vector<std::size_t>>& queues, const std::function<void(std::size_t)>& task)
+{
+#ifndef NO_MULTITHREADING
+	// [Node] -> The next item of the node's queue.
+	std::vector<std::atomic<std::size_t>> next(queues.size());
+
+	std::exception_ptr error{};
+	std::atomic<bool> failed{};
+
+	const auto work = [&](const std::size_t home, const int cpu)
+	{
+		pin_thread(cpu);
+
+		// The node's own queue comes first, and then the queues of the nodes after it.
+		for (std::size_t offset{}; offset < queues.size() && !failed.load(std::memory_order_relaxed); ++offset)
+		{
+			const std::size_t node{ (home + offset) % queues.size() };
+			for (std::size_t i{ next[node]++ }; i < queues[node].size(); i = next[node]++)
+			{
+				try
+				{
+					task(queues[node][i]);
+				}
+				catch (...)
+				{
+					if (!failed.exchange(true))
+						error = std::current_exception();
+					return;
+				}
+			}
+		}
+	};
+
+	std::vector<std::thread> threads{};
+	for (std::size_t node{}; node < cpus.size(); ++node)
+	{
+		for (const int cpu : cpus[node])
+			threads.emplace_back(work, node % std::max<std::size_t>(queues.size(), 1), cpu);
+	}
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	if (error)
+		std::rethrow_exception(error);
+#else
+	static_cast<void>(cpus);
+	for (const std::vector<std::size_t>& queue : queues)
+	{
+		for (const std::size_t item : queue)
+			task(item);
+	}
+#endif
+}
+
+// ================================================================================================================================ //
+
+// Rounds the size up to a whole number of huge pages.
+static std::size_t round_to_huge_pages(const std::size_t bytes) noexcept
+{
+	return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+PageResource::PageResource(const PageMode mode, const int node) noexcept
+	:
+	mode{ mode }, node{ node }, mapped{}
+{}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void* PageResource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+#ifdef __linux__
+	const std::size_t size{ round_to_huge_pages(std::max<std::size_t>(bytes, 1)) };
+
+	void* memory{ MAP_FAILED };
+	if (mode == PageMode::Explicit)
+	{
+		memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+		// The pool is empty (or was never reserved), so the rest of the memory is backed by transparent huge pages.
+		if (memory == MAP_FAILED)
+			mode = PageMode::Transparent;
+	}
+
+	if (memory == MAP_FAILED)
+	{
+		// An extra huge page is mapped so that the mapping can be trimmed to start on a huge page boundary
+		// (the kernel only backs whole, aligned huge pages).
+		char* const start{ static_cast<char*>(mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) };
+		if (start == MAP_FAILED)
+			throw std::bad_alloc{};
+
+		const std::size_t head{ (huge_page_size - reinterpret_cast<std::uintptr_t>(start) % huge_page_size) % huge_page_size };
+		if (head != 0)
+			munmap(start, head);
+		if (huge_page_size - head != 0)
+			munmap(start + head + size, huge_page_size - head);
+
+		memory = start + head;
+
+		if (mode == PageMode::Transparent)
+			madvise(memory, size, MADV_HUGEPAGE);
+	}
+
+	// The memory is placed before it is first touched, as that is when its pages are given a node.
+	// Placement is a preference rather than a binding, so that a full node still gives memory from the others.
+	if (node >= 0 && node < 64)
+	{
+		constexpr int preferred_policy{ 1 }; // MPOL_PREFERRED
+		const unsigned long nodes{ 1ul << node };
+		syscall(SYS_mbind, memory, size, preferred_policy, &nodes, sizeof(nodes) * 8, 0);
+	}
+
+	mapped += size;
+	static_cast<void>(alignment);
+	return memory;
+#else
+	mapped += bytes;
+	return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void PageResource::do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment)
+{
+#ifdef __linux__
+	const std::size_t size{ round_to_huge_pages(std::max<std::size_t>(bytes, 1)) };
+	munmap(pointer, size);
+	mapped -= size;
+	static_cast<void>(alignment);
+#else
+	std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+	mapped -= bytes;
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool PageResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+// ================================================================================================================================ //
+
+ReadOnlyArena::ReadOnlyArena(const PageMode mode, const int node)
+	:
+	pages{ mode, node }, buffer{ arena_chunk_size, &pages }
+{}
+
+// ================================================================================================================================ //
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <memory_resource>
+
+// ================================================================================================================================ //
+
+// How the pages of the data that every worker reads are backed.
+enum class PageMode
+{
+	Default,     // The pages of the standard allocator.
+	Transparent, // Transparent huge pages (asked for with madvise(), and given if the kernel has them to spare).
+	Explicit     // Huge pages from the kernel's reserved pool (vm.nr_hugepages), or transparent ones if the pool is empty.
+};
+
+// Returns the name of the mode (as it is given to the commands).
+std::string page_mode_name(const PageMode mode);
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Settings for where the data that every game reads is placed, and which CPUs the games are played on.
+struct PlacementOptions
+{
+	// How the pages of the shared data are backed.
+	PageMode pages{ PageMode::Default };
+
+	// If true, the shared data is copied to every NUMA node that runs workers, and the workers of a node only read its own copy.
+	bool replicate{};
+
+	// If not 0, the games are played by this many workers, each pinned to its own CPU (instead of by the standard parallel algorithms).
+	std::size_t threads{};
+
+	// Returns true if any setting differs from the default.
+	inline bool enabled() const noexcept
+	{
+		return pages != PageMode::Default || replicate || threads != 0;
+	}
+};
+
+// ================================================================================================================================ //
+
+// A NUMA node and the CPUs that it holds (which the process is allowed to run on).
+struct NumaNode
+{
+	int id;
+	std::vector<int> cpus;
+};
+
+// Returns the NUMA nodes of the machine, or a single node (with an id of -1) holding every CPU if the topology is not known.
+const std::vector<NumaNode>& numa_nodes();
+
+// Returns the number of CPUs across every node.
+std::size_t cpu_count();
+
+// Returns the CPUs that the given number of workers are pinned to, by node (in the order of numa_nodes()).
+// Each node is filled before the next one is used, so that a small run stays on one socket (CPUs are reused past the last one).
+std::vector<std::vector<int>> pick_cpus(const std::size_t count);
+
+// Returns the number of bytes of the process that are backed by transparent huge pages (or 0 if that is not known).
+std::size_t huge_page_bytes();
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Calls the task with every item of the queues, on one thread per CPU (each pinned to its CPU), and returns once they are all done.
+// queues[Node] holds the items whose data is on the node: the workers of a node take its items first, and then help the other nodes.
+// The first exception that a task throws is rethrown once every worker has stopped.
+void run_pinned(const std::vector<std::vector<int>>& cpus, const std::vector<std::vector<std::size_t>>& queues, const std::function<void(std::size_t)>& task);
+
+// ================================================================================================================================ //
+
+/*
+	A memory resource that maps every allocation straight from the OS, in whole (huge) pages backed by a PageMode and placed on a
+	NUMA node. Every allocation is its own mapping, so it is meant as the upstream of a resource that packs the small allocations
+	of a structure into large chunks (see ReadOnlyArena).
+
+	Placement and huge pages are only available on Linux: on other systems the memory comes from the standard allocator.
+*/
+class PageResource : public std::pmr::memory_resource
+{
+private: // Variables
+
+	// How the pages are backed (an explicit mode falls back to transparent pages once the kernel has none to give).
+	PageMode mode;
+
+	// The NUMA node that the memory is placed on (or -1 to leave it to the OS).
+	const int node;
+
+	// The number of bytes that are mapped.
+	std::size_t mapped;
+
+public: // Functions
+
+	PageResource(const PageMode mode, const int node = -1) noexcept;
+
+	// Returns how the pages are backed.
+	inline PageMode backing() const noexcept
+	{
+		return mode;
+	}
+
+	// Returns the number of bytes that are mapped (including the rest of the last page of each mapping).
+	inline std::size_t mapped_bytes() const noexcept
+	{
+		return mapped;
+	}
+
+private: // Helper Functions
+
+	void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+	void do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+/*
+	Memory for data that is built once and then only read (by many threads at once), such as the dictionaries and their indices.
+	Allocations are packed back-to-back into huge-page sized chunks of a PageResource, and are only freed with the arena.
+*/
+class ReadOnlyArena
+{
+private: // Variables
+
+	PageResource pages;
+	std::pmr::monotonic_buffer_resource buffer;
+
+public: // Functions
+
+	ReadOnlyArena(const PageMode mode, const int node = -1);
+
+	ReadOnlyArena(const ReadOnlyArena&) = delete;
+	ReadOnlyArena& operator=(const ReadOnlyArena&) = delete;
+
+	// Returns the resource that allocates from the arena.
+	inline std::pmr::memory_resource* resource() noexcept
+	{
+		return &buffer;
+	}
+
+	// Returns how the pages of the arena are backed.
+	inline PageMode backing() const noexcept
+	{
+		return pages.backing();
+	}
+
+	// Returns the number of bytes that the arena has taken from the OS.
+	inline std::size_t mapped_bytes() const noexcept
+	{
+		return pages.mapped_bytes();
+	}
+
+};
+
+// ================================================================================================================================ //
@@ -0,0 +1,299 @@
+#include "Profiler.h"
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <cerrno>
+
+// Hardware counters are only read on Linux (every other platform records the calls and the time alone).
+#ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+// ================================================================================================================================ //
+
+// The names of the Phases and Events (in the order of their enums).
+inline constexpr const char* phase_names[phase_count]{ "Guess", "Simulate", "Filter" };
+inline constexpr const char* event_names[event_count]{ "Cycles", "Instructions", "L1D Misses", "LLC Misses", "Branch Misses" };
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// The totals of a single Phase.
+struct PhaseTotals
+{
+	std::uint64_t calls;
+	std::uint64_t nanoseconds;
+	std::array<std::uint64_t, event_count> counts;
+};
+
+// The counters and the totals of a single thread.
+struct ThreadProfile
+{
+	// [Event] -> File Descriptor of the counter (or -1 if it could not be opened). The first open counter leads the group.
+	std::array<int, event_count> counters;
+	int leader;
+
+	// [Phase] -> Totals of the Phase on this thread.
+	std::array<PhaseTotals, phase_count> totals;
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Set while profiling is enabled.
+static std::atomic<bool> enabled{};
+
+// The profile of every thread that has ever profiled a Phase (they are never freed, since threads may end before the report).
+static std::mutex profiles_mutex{};
+static std::vector<std::unique_ptr<ThreadProfile>> profiles{};
+
+// Why the first counter that failed to open could not be opened (empty if every counter opened).
+static std::string unavailable_reason{};
+
+// ================================================================================================================================ //
+
+#ifdef __linux__
+
+// Returns the perf_event_attr for an Event.
+static perf_event_attr event_attributes(const Event event) noexcept
+{
+	perf_event_attr attr{};
+	attr.size = sizeof(attr);
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+
+	switch (event)
+	{
+	case Event::Cycles:
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = PERF_COUNT_HW_CPU_CYCLES;
+		break;
+	case Event::Instructions:
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+		break;
+	case Event::L1Misses:
+		attr.type = PERF_TYPE_HW_CACHE;
+		attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		break;
+	case Event::LLCMisses:
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = PERF_COUNT_HW_CACHE_MISSES;
+		break;
+	case Event::BranchMisses:
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+		break;
+	}
+	return attr;
+}
+
+#endif
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Opens the counters of the calling thread (any that cannot be opened are left at -1).
+static void open_counters(ThreadProfile& profile)
+{
+	profile.counters.fill(-1);
+	profile.leader = -1;
+
+#ifdef __linux__
+	for (std::size_t e{}; e < event_count; ++e)
+	{
+		perf_event_attr attr{ event_attributes(Event(e)) };
+		const int fd{ int(syscall(SYS_perf_event_open, &attr, 0, -1, profile.leader, 0)) };
+
+		if (fd == -1)
+		{
+			const std::lock_guard lock{ profiles_mutex };
+			if (unavailable_reason.empty())
+			{
+				int paranoid{};
+				std::ifstream{ "/proc/sys/kernel/perf_event_paranoid" } >> paranoid;
+				unavailable_reason = std::string(event_names[e]) + ": perf_event_open failed (" + std::strerror(errno) + ", perf_event_paranoid = " + std::to_string(paranoid) + ")";
+			}
+			continue;
+		}
+
+		profile.counters[e] = fd;
+		if (profile.leader == -1)
+			profile.leader = fd;
+	}
+#else
+	const std::lock_guard lock{ profiles_mutex };
+	unavailable_reason = "hardware counters are only supported on Linux";
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the profile of the calling thread (opening its counters on first use).
+static ThreadProfile& thread_profile()
+{
+	thread_local ThreadProfile* profile{};
+
+	if (!profile)
+	{
+		auto created{ std::make_unique<ThreadProfile>() };
+		open_counters(*created);
+
+		const std::lock_guard lock{ profiles_mutex };
+		profile = profiles.emplace_back(std::move(created)).get();
+	}
+	return *profile;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the current value of every counter of the thread (0 for the ones that are not open).
+static std::array<std::uint64_t, event_count> read_counters(const ThreadProfile& profile) noexcept
+{
+	std::array<std::uint64_t, event_count> counts{};
+
+#ifdef __linux__
+	if (profile.leader == -1)
+		return counts;
+
+	// A group is read as the number of counters, followed by the value of each (in the order that they were opened).
+	std::uint64_t values[1 + event_count]{};
+	if (read(profile.leader, values, sizeof(values)) <= 0)
+		return counts;
+
+	std::size_t v{ 1 };
+	for (std::size_t e{}; e < event_count && v <= values[0]; ++e)
+	{
+		if (profile.counters[e] != -1)
+			counts[e] = values[v++];
+	}
+#endif
+
+	return counts;
+}
+
+// ================================================================================================================================ //
+
+PhaseScope::PhaseScope(const Phase phase)
+	:
+	phase{ phase }, active{ enabled.load(std::memory_order_relaxed) }, start_counts{}, start_time{}
+{
+	if (active)
+	{
+		start_counts = read_counters(thread_profile());
+		start_time = std::chrono::steady_clock::now();
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+PhaseScope::~PhaseScope()
+{
+	if (!active) return;
+
+	const auto end_time{ std::chrono::steady_clock::now() };
+	ThreadProfile& profile{ thread_profile() };
+	const std::array<std::uint64_t, event_count> end_counts{ read_counters(profile) };
+
+	PhaseTotals& totals{ profile.totals[std::size_t(phase)] };
+	++totals.calls;
+	totals.nanoseconds += std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+
+	for (std::size_t e{}; e < event_count; ++e)
+		totals.counts[e] += end_counts[e] - start_counts[e];
+}
+
+// ================================================================================================================================ //
+
+void start_profiling()
+{
+	{
+		const std::lock_guard lock{ profiles_mutex };
+		for (const auto& profile : profiles)
+			profile->totals = {};
+	}
+	enabled = true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void stop_profiling() noexcept
+{
+	enabled = false;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool profiling_enabled() noexcept
+{
+	return enabled;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::string profile_report()
+{
+	const std::lock_guard lock{ profiles_mutex };
+
+	std::array<PhaseTotals, phase_count> totals{};
+	std::array<bool, event_count> counted{};
+
+	for (const auto& profile : profiles)
+	{
+		for (std::size_t p{}; p < phase_count; ++p)
+		{
+			totals[p].calls += profile->totals[p].calls;
+			totals[p].nanoseconds += profile->totals[p].nanoseconds;
+
+			for (std::size_t e{}; e < event_count; ++e)
+				totals[p].counts[e] += profile->totals[p].counts[e];
+		}
+
+		for (std::size_t e{}; e < event_count; ++e)
+			counted[e] |= (profile->counters[e] != -1);
+	}
+
+	constexpr int width{ 15 };
+
+	std::ostringstream report{};
+	report << "==== PROFILE ====\n\n";
+	report << std::left << std::setw(10) << "Phase" << std::right << std::setw(width) << "Calls" << std::setw(width) << "Time (ms)";
+	for (const char* const name : event_names)
+		report << std::setw(width) << name;
+	report << std::setw(8) << "IPC" << '\n';
+
+	for (std::size_t p{}; p < phase_count; ++p)
+	{
+		report << std::left << std::setw(10) << phase_names[p] << std::right << std::setw(width) << totals[p].calls
+			<< std::setw(width) << std::fixed << std::setprecision(1) << (totals[p].nanoseconds / 1e6);
+
+		for (std::size_t e{}; e < event_count; ++e)
+		{
+			if (counted[e])
+				report << std::setw(width) << totals[p].counts[e];
+			else
+				report << std::setw(width) << "n/a";
+		}
+
+		const std::uint64_t cycles{ totals[p].counts[std::size_t(Event::Cycles)] };
+		const std::uint64_t instructions{ totals[p].counts[std::size_t(Event::Instructions)] };
+		if (cycles != 0 && counted[std::size_t(Event::Instructions)])
+			report << std::setw(8) << std::setprecision(2) << (double(instructions) / double(cycles)) << '\n';
+		else
+			report << std::setw(8) << "n/a" << '\n';
+	}
+
+	if (!unavailable_reason.empty())
+		report << "\n* Some hardware counters were unavailable (" << unavailable_reason << ").\n";
+
+	report << "\n=================\n";
+	return report.str();
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <chrono>
+#include <string>
+
+// ================================================================================================================================ //
+
+// The parts of a test whose costs are profiled separately.
+// Guess: WordleAI::makeGuess(). Simulate: the Feedback of each guess (make_pattern() to group the games, then WordleSim::make_guess()
+// once for each group). Filter: WordleAI::updateDictionary().
+enum class Phase { Guess, Simulate, Filter };
+
+inline constexpr std::size_t phase_count{ 3 };
+
+// The hardware events that are counted for each Phase.
+enum class Event { Cycles, Instructions, L1Misses, LLCMisses, BranchMisses };
+
+inline constexpr std::size_t event_count{ 5 };
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+/*
+	Counts the hardware events (and the time) spent in one Phase on the calling thread, from construction until destruction.
+
+	Every thread opens its own group of counters (with Linux's perf_event_open) the first time that it profiles a Phase,
+	and reads the whole group with a single system call at each end of the scope. The counts are added to totals kept for that thread,
+	which profile_report() adds up once the threads are done.
+
+	When profiling is not enabled, a scope only checks a flag. When the counters cannot be opened (in most containers, on other platforms,
+	or when perf_event_paranoid forbids it), the number of calls and the time are still recorded.
+*/
+class PhaseScope
+{
+private: // Variables
+
+	// The Phase being profiled.
+	Phase phase;
+
+	// False if profiling was not enabled when the scope began.
+	bool active;
+
+	// The counters and the time when the scope began.
+	std::array<std::uint64_t, event_count> start_counts;
+	std::chrono::steady_clock::time_point start_time;
+
+public: // Functions
+
+	explicit PhaseScope(const Phase phase);
+
+	~PhaseScope();
+
+	PhaseScope(const PhaseScope&) = delete;
+	PhaseScope& operator=(const PhaseScope&) = delete;
+
+};
+
+// ================================================================================================================================ //
+
+// Clears the totals of every thread and enables profiling.
+void start_profiling();
+
+// Disables profiling (the totals are kept until the next start_profiling()).
+void stop_profiling() noexcept;
+
+// Returns true if profiling is enabled.
+bool profiling_enabled() noexcept;
+
+// Returns a table of the totals of every Phase over every thread (with the reason if the hardware counters were unavailable).
+std::string profile_report();
+
+// ================================================================================================================================ //
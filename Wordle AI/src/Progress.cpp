@@ -0,0 +1,232 @@
+#include "Progress.h"
+
+#include <csignal>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+// Metrics are sent over POSIX sockets, which are not available on Windows.
+#ifndef _WIN32
+#  include <unistd.h>
+#  include <arpa/inet.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#endif
+
+// ================================================================================================================================ //
+
+ProgressCounters::ProgressCounters() noexcept
+	:
+	slots{}
+{}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void ProgressCounters::add_game(const std::size_t turns) noexcept
+{
+	// Every thread is given the next slot the first time that it records a game.
+	static std::atomic<std::size_t> next_slot{};
+	thread_local const std::size_t slot_index{ next_slot.fetch_add(1, std::memory_order_relaxed) % slot_count };
+
+	Slot& slot{ slots[slot_index] };
+	slot.games.fetch_add(1, std::memory_order_relaxed);
+	slot.wins.fetch_add(turns <= 6 ? 1 : 0, std::memory_order_relaxed);
+	slot.turns.fetch_add(turns, std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+ProgressCounters::Totals ProgressCounters::totals() const noexcept
+{
+	Totals totals{};
+	for (const Slot& slot : slots)
+	{
+		totals.games += slot.games.load(std::memory_order_relaxed);
+		totals.wins += slot.wins.load(std::memory_order_relaxed);
+		totals.turns += slot.turns.load(std::memory_order_relaxed);
+	}
+	return totals;
+}
+
+// ================================================================================================================================ //
+
+// Returns true if the string is a port number.
+static bool is_port(const std::string& str)
+{
+	return !str.empty() && str.size() <= 5 && std::all_of(str.begin(), str.end(), [](const char chr) { return chr >= '0' && chr <= '9'; }) && std::stoul(str) <= 65535;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+ProgressReporter::ProgressReporter(const ProgressCounters& counters, const std::size_t total_games, const ProgressOptions& options)
+	:
+	counters{ counters }, total_games{ total_games }, options{ options }, start_time{ std::chrono::steady_clock::now() },
+	last_games{}, last_time{ start_time }, file{}, socket{ -1 }, port{}, mutex{}, stop_requested{}, stopping{ false }, thread{}
+{
+	if (is_port(options.metrics))
+	{
+#ifdef _WIN32
+		throw std::runtime_error("Metrics can only be sent to a port on POSIX systems.");
+#else
+		socket = ::socket(AF_INET, SOCK_DGRAM, 0);
+		if (socket < 0)
+			throw std::runtime_error("Unable to create metrics socket.");
+
+		port = static_cast<std::uint16_t>(std::stoul(options.metrics));
+#endif
+	}
+	else if (!options.metrics.empty())
+	{
+		file.open(options.metrics);
+		if (!file)
+			throw std::runtime_error("Unable to open metrics file.");
+	}
+
+	if (options.interval > 0 || !options.metrics.empty())
+		thread = std::thread{ &ProgressReporter::run, this };
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+ProgressReporter::~ProgressReporter()
+{
+	{
+		const std::lock_guard lock{ mutex };
+		stopping = true;
+	}
+	stop_requested.notify_all();
+
+	if (thread.joinable())
+		thread.join();
+
+	// The final sample is only exported (the statistics of the run are printed right after it).
+	if (!options.metrics.empty())
+		report(false, true);
+
+#ifndef _WIN32
+	if (socket >= 0)
+		::close(socket);
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void ProgressReporter::run()
+{
+	// Metrics are still exported every 5 seconds when the status line is disabled.
+	const std::chrono::duration<double> interval{ options.interval > 0 ? options.interval : 5.0 };
+
+	std::unique_lock lock{ mutex };
+	while (!stop_requested.wait_for(lock, interval, [&]() { return stopping; }))
+	{
+		report(options.interval > 0, false);
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void ProgressReporter::report(const bool print, const bool final)
+{
+	const auto now{ std::chrono::steady_clock::now() };
+	const ProgressCounters::Totals totals{ counters.totals() };
+
+	const double elapsed{ std::chrono::duration<double>{ now - start_time }.count() };
+	const double interval{ std::chrono::duration<double>{ now - last_time }.count() };
+	const double rate{ interval > 0 ? double(totals.games - last_games) / interval : 0.0 };
+
+	// The time left is estimated from the average rate of the whole run (which is steadier than the latest rate).
+	const double average_rate{ elapsed > 0 ? double(totals.games) / elapsed : 0.0 };
+	const double eta{ average_rate > 0 ? double(total_games - std::min<std::uint64_t>(totals.games, total_games)) / average_rate : -1.0 };
+
+	const double win_rate{ totals.games != 0 ? 100.0 * double(totals.wins) / double(totals.games) : 0.0 };
+	const double average_turns{ totals.games != 0 ? double(totals.turns) / double(totals.games) : 0.0 };
+
+	last_games = totals.games;
+	last_time = now;
+
+	if (print)
+	{
+		std::ostringstream line{};
+		line << std::fixed << std::setprecision(1)
+			<< "[" << std::setw(7) << elapsed << "s] " << totals.games << " / " << total_games << " games ("
+			<< (total_games != 0 ? 100.0 * double(totals.games) / double(total_games) : 0.0) << "%) | "
+			<< std::setprecision(0) << rate << " games/s | ETA ";
+
+		if (eta < 0)
+			line << "--";
+		else
+			line << std::setprecision(1) << eta << 's';
+
+		line << std::setprecision(2) << " | Wins " << win_rate << "% | Turn Avg. " << std::setprecision(4) << average_turns << '\n';
+
+		std::cout << line.str() << std::flush;
+	}
+
+	if (options.metrics.empty())
+		return;
+
+	std::ostringstream metrics{};
+	metrics
+		<< "elapsed_s " << elapsed << " games " << totals.games << " total " << total_games << " games_per_s " << rate << " eta_s " << eta
+		<< " win_pct " << win_rate << " avg_turns " << average_turns << " final " << (final ? 1 : 0) << " cancelled " << (cancel_requested() ? 1 : 0) << '\n';
+
+	if (file.is_open())
+	{
+		file << metrics.str() << std::flush;
+	}
+#ifndef _WIN32
+	else if (socket >= 0)
+	{
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_port = htons(port);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		// Metrics are best-effort, so a datagram that cannot be sent is dropped.
+		const std::string datagram{ metrics.str() };
+		::sendto(socket, datagram.data(), datagram.size(), 0, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+	}
+#endif
+}
+
+// ================================================================================================================================ //
+
+// Set by the handler (a lock-free atomic, so it is safe to set from a signal handler).
+static std::atomic<bool> cancelled{};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Requests cancellation when Ctrl-C is pressed.
+static void handle_interrupt(const int)
+{
+	cancelled.store(true, std::memory_order_relaxed);
+
+	// A second Ctrl-C terminates the program.
+	std::signal(SIGINT, SIG_DFL);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+InterruptScope::InterruptScope()
+{
+	cancelled.store(false, std::memory_order_relaxed);
+	std::signal(SIGINT, handle_interrupt);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+InterruptScope::~InterruptScope()
+{
+	std::signal(SIGINT, SIG_DFL);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool cancel_requested() noexcept
+{
+	return cancelled.load(std::memory_order_relaxed);
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <condition_variable>
+
+// ================================================================================================================================ //
+
+/*
+	Counts the games that a test run has finished, while they are being played.
+
+	Every thread adds to its own slot (a cache line of relaxed atomics), so recording a game never takes a lock or contends with
+	another thread. The totals are only added up when a reporter samples them.
+*/
+class ProgressCounters
+{
+public: // Data Structures
+
+	// The sum of every slot.
+	struct Totals
+	{
+		std::uint64_t games;
+		std::uint64_t wins;
+		std::uint64_t turns;
+	};
+
+private: // Data Structures
+
+	struct alignas(64) Slot
+	{
+		std::atomic<std::uint64_t> games;
+		std::atomic<std::uint64_t> wins;
+		std::atomic<std::uint64_t> turns;
+	};
+
+	// Threads beyond this many share slots (which is still correct, only slower).
+	static constexpr std::size_t slot_count{ 64 };
+
+private: // Variables
+
+	std::array<Slot, slot_count> slots;
+
+public: // Functions
+
+	ProgressCounters() noexcept;
+
+	// Records a finished game that took the given number of turns.
+	void add_game(const std::size_t turns) noexcept;
+
+	// Returns the sum of every slot (games that are recorded while it is summing may or may not be included).
+	Totals totals() const noexcept;
+
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Settings for a ProgressReporter.
+struct ProgressOptions
+{
+	// How often the status line is printed (in seconds, 0 disables it).
+	double interval{ 5.0 };
+
+	// If not empty, every sample is also exported: sent as a UDP datagram to localhost if it is a port number, or else written to the file.
+	std::string metrics{};
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+/*
+	A thread that samples the ProgressCounters at a fixed interval, and prints a status line with the games done, the games per second,
+	the estimated time left, the win rate and the average number of turns so far.
+
+	The same metrics can be exported as one line of "<name> <value>" pairs per sample (like the server's "stats" reply).
+	The reporter runs from construction until destruction (which exports one last sample).
+*/
+class ProgressReporter
+{
+private: // Variables
+
+	const ProgressCounters& counters;
+	const std::size_t total_games;
+	const ProgressOptions options;
+
+	const std::chrono::steady_clock::time_point start_time;
+
+	// The previous sample (the games per second are measured between samples).
+	std::uint64_t last_games;
+	std::chrono::steady_clock::time_point last_time;
+
+	// Where the metrics are exported to (a file, or a UDP socket).
+	std::ofstream file;
+	int socket;
+	std::uint16_t port;
+
+	// The reporting thread, and the flag that stops it.
+	std::mutex mutex;
+	std::condition_variable stop_requested;
+	bool stopping;
+	std::thread thread;
+
+public: // Functions
+
+	// Starts reporting on the counters (throws if the metrics cannot be exported to the target).
+	ProgressReporter(const ProgressCounters& counters, const std::size_t total_games, const ProgressOptions& options);
+
+	// Stops reporting (after exporting the final sample).
+	~ProgressReporter();
+
+	ProgressReporter(const ProgressReporter&) = delete;
+	ProgressReporter& operator=(const ProgressReporter&) = delete;
+
+private: // Helper Functions
+
+	// Prints a status line every interval until stopped.
+	void run();
+
+	// Samples the counters, and prints (and/or exports) the sample.
+	void report(const bool print, const bool final);
+
+};
+
+// ================================================================================================================================ //
+
+/*
+	While a scope exists, Ctrl-C (SIGINT) requests cancellation instead of terminating the program.
+	Long loops check cancel_requested() and stop early, so that the partial results can still be written.
+	A second Ctrl-C terminates the program as usual.
+*/
+class InterruptScope
+{
+public: // Functions
+
+	// Clears any earlier request, and installs the handler.
+	InterruptScope();
+
+	// Restores the default handler.
+	~InterruptScope();
+
+	InterruptScope(const InterruptScope&) = delete;
+	InterruptScope& operator=(const InterruptScope&) = delete;
+
+};
+
+// Returns true once cancellation has been requested (by Ctrl-C while an InterruptScope exists).
+bool cancel_requested() noexcept;
+
+// ================================================================================================================================ //
@@ -0,0 +1,67 @@
+#include "Random.h"
+
+#include <atomic>
+#include <random>
+
+// ================================================================================================================================ //
+
+// Returns the next value of a SplitMix64 sequence (used to expand a single seed into a full state).
+static std::uint64_t splitmix(std::uint64_t& x) noexcept
+{
+	std::uint64_t z{ x += 0x9E3779B97F4A7C15ull };
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Random::Random(std::uint64_t seed) noexcept
+	:
+	state{ splitmix(seed), splitmix(seed), splitmix(seed), splitmix(seed) }
+{}
+
+// ================================================================================================================================ //
+
+// The seed that every thread's generator is derived from.
+static std::atomic<std::uint64_t> global_seed{ std::random_device{}() };
+
+// Incremented every time the seed is changed, so that threads know to re-seed their generators.
+static std::atomic<std::uint64_t> seed_generation{ 1 };
+
+// Number of threads that have seeded a generator since the seed was last changed.
+static std::atomic<std::uint64_t> seeded_threads{};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void set_random_seed(const std::uint64_t seed) noexcept
+{
+	global_seed = seed;
+	seeded_threads = 0;
+	++seed_generation;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::uint64_t random_seed() noexcept
+{
+	return global_seed;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Random& thread_random() noexcept
+{
+	thread_local Random generator{ 0 };
+	thread_local std::uint64_t generation{};
+
+	if (generation != seed_generation)
+	{
+		// The first thread to use the generator after seeding gets the seed itself, so single-threaded runs are reproducible.
+		generation = seed_generation;
+		generator = Random{ global_seed + 0x9E3779B97F4A7C15ull * seeded_threads++ };
+	}
+	return generator;
+}
+
+// ================================================================================================================================ //
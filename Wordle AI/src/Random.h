@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+
+// ================================================================================================================================ //
+
+/*
+	A small and fast Pseudo-Random Number Generator (xoshiro256**).
+	It meets the requirements of a UniformRandomBitGenerator, so it can be used with <random> and std::sample().
+*/
+class Random
+{
+public: // Data Structures
+
+	using result_type = std::uint64_t;
+
+private: // Variables
+
+	std::uint64_t state[4];
+
+public: // Functions
+
+	// Constructs the generator from a seed (the same seed always gives the same sequence).
+	explicit Random(const std::uint64_t seed) noexcept;
+
+	// Returns the next number in the sequence.
+	inline result_type operator()() noexcept
+	{
+		const std::uint64_t result{ rotl(state[1] * 5, 7) * 9 };
+		const std::uint64_t t{ state[1] << 17 };
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+
+		return result;
+	}
+
+	static constexpr result_type min() noexcept
+	{
+		return std::numeric_limits<result_type>::min();
+	}
+
+	static constexpr result_type max() noexcept
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+private: // Helper Functions
+
+	static constexpr std::uint64_t rotl(const std::uint64_t x, const int k) noexcept
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+};
+
+// ================================================================================================================================ //
+
+// Sets the seed that every thread's generator is derived from (generators are re-seeded on their next use).
+void set_random_seed(const std::uint64_t seed) noexcept;
+
+// Returns the current seed (chosen randomly at startup unless set_random_seed() was called).
+std::uint64_t random_seed() noexcept;
+
+// Returns the generator for the calling thread.
+Random& thread_random() noexcept;
+
+// ================================================================================================================================ //
@@ -0,0 +1,86 @@
+#include "SearchState.h"
+
+#include <stdexcept>
+
+// ================================================================================================================================ //
+
+SearchState::SearchState(const LetterIndex& index, const CandidateSet& candidates, const LetterSet& invalidated)
+	:
+	dict{ &index.dictionary() }, index{ &index }, ids{ candidates.begin(), candidates.end() }, candidates{ candidates.words() },
+	candidate_count{ candidates.size() }, invalidated{ invalidated }, undo_log{}, constraints{}
+{
+	if (&candidates.dictionary() != &index.dictionary())
+		throw std::runtime_error("SearchState requires candidates from the indexed Dictionary.");
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+SearchState::SearchState(const CandidateSet& candidates)
+	:
+	dict{ &candidates.dictionary() }, index{}, ids{ candidates.begin(), candidates.end() }, candidates{ candidates.words() },
+	candidate_count{ candidates.size() }, invalidated{}, undo_log{}, constraints{}
+{}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+SearchState::SearchState(const Dictionary& dict)
+	:
+	dict{ &dict }, index{}, ids(dict.size()), candidates(dict.size(), true), candidate_count{ dict.size() }, invalidated{}, undo_log{},
+	constraints{}
+{
+	for (std::size_t i{}; i < ids.size(); ++i)
+		ids[i] = WordID(i);
+}
+
+// ================================================================================================================================ //
+
+void SearchState::rollback(const Snapshot& snapshot) noexcept
+{
+	// Every swap is undone in reverse, which puts the removed word back where it was and the candidate it replaced back at the end.
+	while (undo_log.size() > snapshot.log_size)
+	{
+		const std::size_t i{ undo_log.back() };
+		const WordID removed{ ids[candidate_count] };
+
+		candidates.set(removed);
+		ids[candidate_count] = ids[i];
+		ids[i] = removed;
+
+		++candidate_count;
+		undo_log.pop_back();
+	}
+
+	invalidated = snapshot.invalidated;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t SearchState::apply(const Results& feedback)
+{
+	if (index == nullptr)
+		throw std::runtime_error("SearchState::apply requires a LetterIndex.");
+
+	for (const Feedback f : feedback)
+	{
+		if (f.result == Result::Invalid)
+			invalidated.insert(letter_index(f.letter));
+	}
+
+	constraints.clear();
+	index->for_each_constraint(feedback, [&](const Bitset& set, const bool required)
+	{
+		constraints.emplace_back(&set, required);
+	});
+
+	return keep_if([&](const WordID id)
+	{
+		for (const auto& [set, required] : constraints)
+		{
+			if (set->test(id) != required)
+				return false;
+		}
+		return true;
+	});
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+#include <utility>
+#include <string_view>
+
+#include "Bitset.h"
+#include "Dictionary.h"
+#include "WordleSim.h"
+#include "CandidateSet.h"
+#include "LetterIndex.h"
+
+// ================================================================================================================================ //
+
+/*
+	The state of a game (the remaining candidates and the invalidated letters), built for branching in a search.
+	Candidates are kept at the front of an array of WordIDs (with a Bitset for membership tests). A branch swaps every word that
+	it removes with the last candidate, and only logs the position of the swap: a Snapshot is O(1) to take, a branch is O(candidates),
+	and rolling back is O(removed words), since it undoes the swaps in reverse (which restores the exact order the array had).
+	The candidates are in increasing order until the first branch, and in no particular order inside a branch.
+
+	Exploring "What if I guess X and get Feedback F?" is then:
+		const SearchState::Snapshot before{ state.snapshot() };
+		state.apply(feedback);
+		...
+		state.rollback(before);
+*/
+class SearchState
+{
+public: // Data Structures
+
+	// A point in the history of the state that it can be rolled back to.
+	struct Snapshot
+	{
+		std::size_t log_size;
+		LetterSet invalidated;
+	};
+
+private: // Variables
+
+	// The Dictionary that the candidates are words of.
+	const Dictionary* dict;
+
+	// Index of the Dictionary (only needed by apply()).
+	const LetterIndex* index;
+
+	// [0, candidate_count) -> The remaining candidates.
+	// [candidate_count, ...) -> The words removed by every branch that has not been rolled back yet (the newest first).
+	std::vector<WordID> ids;
+
+	// The remaining candidates (by WordID).
+	Bitset candidates;
+
+	// The number of remaining candidates.
+	std::size_t candidate_count;
+
+	// Letters that have been invalidated.
+	LetterSet invalidated;
+
+	// The position of every removed word when it was swapped with the last candidate (in the order of the swaps).
+	std::vector<std::uint32_t> undo_log;
+
+	// The sets that apply() tests each candidate against, and whether a candidate must be in them (reused to avoid an allocation for every branch).
+	std::vector<std::pair<const Bitset*, bool>> constraints;
+
+public: // Functions
+
+	// Constructs the state from a set of candidates (which must be words of the indexed Dictionary).
+	SearchState(const LetterIndex& index, const CandidateSet& candidates, const LetterSet& invalidated);
+
+	// Constructs the state from a set of candidates, without an index (so it can only be branched with keep_if()).
+	explicit SearchState(const CandidateSet& candidates);
+
+	// Constructs the state from every word of the Dictionary, without an index.
+	explicit SearchState(const Dictionary& dict);
+
+	// Returns a Snapshot of the current state.
+	inline Snapshot snapshot() const noexcept
+	{
+		return { undo_log.size(), invalidated };
+	}
+
+	// Restores the state to the given Snapshot (which must not be newer than the current state).
+	void rollback(const Snapshot& snapshot) noexcept;
+
+	// Removes the candidates that are not consistent with the Feedback and returns the number that remain (requires an index).
+	std::size_t apply(const Results& feedback);
+
+	// Removes the candidates for which keep(WordID) returns false and returns the number that remain.
+	// Every candidate is tested once, but not in order (the candidate that replaces a removed word is tested next).
+	template<class Predicate>
+	inline std::size_t keep_if(Predicate&& keep)
+	{
+		for (std::size_t i{}; i < candidate_count;)
+		{
+			const WordID id{ ids[i] };
+			if (keep(id))
+			{
+				++i;
+				continue;
+			}
+
+			--candidate_count;
+			ids[i] = ids[candidate_count];
+			ids[candidate_count] = id;
+
+			candidates.reset(id);
+			undo_log.push_back(std::uint32_t(i));
+		}
+		return candidate_count;
+	}
+
+	// Returns the number of remaining candidates.
+	inline std::size_t size() const noexcept
+	{
+		return candidate_count;
+	}
+
+	// Returns true if no candidates remain.
+	inline bool empty() const noexcept
+	{
+		return candidate_count == 0;
+	}
+
+	// Returns true if the given word is still a candidate.
+	inline bool contains(const WordID id) const noexcept
+	{
+		return candidates.test(id);
+	}
+
+	// Returns true if the given letter has been invalidated.
+	inline bool is_invalidated(const char letter) const noexcept
+	{
+		return invalidated.contains(letter_index(letter));
+	}
+
+	// Returns the remaining candidates.
+	inline const Bitset& words() const noexcept
+	{
+		return candidates;
+	}
+
+	// Returns the word with the given index.
+	inline std::string_view word(const WordID id) const noexcept
+	{
+		return (*dict)[id];
+	}
+
+	// Returns the Dictionary that the candidates are words of.
+	inline const Dictionary& dictionary() const noexcept
+	{
+		return *dict;
+	}
+
+	// Calls the function with the WordID of every remaining candidate (in the order of the array).
+	template<class Function>
+	inline void for_each(Function&& function) const
+	{
+		for (const WordID id : *this)
+			function(id);
+	}
+
+	// The remaining candidates (a contiguous range, so they can be passed on as [begin(), end())).
+	inline const WordID* begin() const noexcept
+	{
+		return ids.data();
+	}
+
+	inline const WordID* end() const noexcept
+	{
+		return ids.data() + candidate_count;
+	}
+
+};
+
+// ================================================================================================================================ //
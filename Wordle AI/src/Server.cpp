@@ -0,0 +1,427 @@
+#include "Server.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <chrono>
+
+#include "WordleSim.h"
+#include "WordleAI.h"
+
+// The server uses POSIX sockets, which are not available on Windows.
+#ifndef _WIN32
+#  include <cerrno>
+#  include <unistd.h>
+#  include <arpa/inet.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#endif
+
+// ================================================================================================================================ //
+
+SolverServer::Context::Context(Dictionary&& dict)
+	:
+	guesses{ std::move(dict) }, view{ guesses }, index{ guesses }, words{ guesses }
+{}
+
+// ================================================================================================================================ //
+
+SolverServer::SolverServer(const std::uint16_t port, const std::size_t thread_count)
+	:
+	port{ port }, thread_count{ std::max<std::size_t>(thread_count, 1) }, latency_random{ 1 }, request_count{}, max_latency{},
+	listener{ -1 }, stopping{ false }
+{
+	latencies.reserve(latency_samples);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void SolverServer::run()
+{
+#ifdef _WIN32
+	throw std::runtime_error("The server is only supported on POSIX systems.");
+#else
+	// Load the default dictionary up front, so that the first request does not pay for it.
+	context(default_dictionary, default_length);
+
+	listener = ::socket(AF_INET, SOCK_STREAM, 0);
+	if (listener < 0)
+		throw std::runtime_error("Unable to create server socket.");
+
+	const int reuse{ 1 };
+	::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (::bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 || ::listen(listener, 64) < 0)
+	{
+		::close(listener);
+		throw std::runtime_error("Unable to listen on the given port.");
+	}
+
+	std::cout << "Listening on 127.0.0.1:" << port << " with " << thread_count << " threads...\n";
+
+	std::vector<std::thread> workers{};
+	for (std::size_t i{}; i < thread_count; ++i)
+	{
+		workers.emplace_back(&SolverServer::work, this);
+	}
+
+	while (!stopping)
+	{
+		const int connection{ ::accept(listener, nullptr, nullptr) };
+		if (connection < 0)
+		{
+			// Errors other than an interruption (such as running out of file descriptors) fail every accept until something changes,
+			// so the loop backs off instead of spinning.
+			if (errno != EINTR && errno != ECONNABORTED)
+				std::this_thread::sleep_for(std::chrono::milliseconds{ 100 });
+			continue;
+		}
+
+		if (!open(connection))
+		{
+			::close(connection);
+			break;
+		}
+
+		{
+			const std::lock_guard lock{ connections_mutex };
+			connections.push(connection);
+		}
+		connections_ready.notify_one();
+	}
+
+	connections_ready.notify_all();
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	::close(listener);
+	listener = -1;
+
+	std::cout << "Server stopped. " << stats() << '\n';
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::string SolverServer::handle(const std::string& request)
+{
+	std::string line{ request };
+	make_lowercase(line);
+
+	std::istringstream stream{ line };
+	std::string dictionary{};
+	std::size_t word_length{};
+	stream >> dictionary;
+
+	if (dictionary == "stats")
+		return stats();
+
+	if (dictionary == "shutdown")
+	{
+		stop();
+		return "OK";
+	}
+
+	DictType type{};
+	if (dictionary == "wordle")
+		type = DictType::Wordle;
+	else if (dictionary == "scrabble")
+		type = DictType::Scrabble;
+	else
+		return "ERROR Invalid dictionary.";
+
+	if (!(stream >> word_length) || word_length == any_length)
+		return "ERROR A word length must be given.";
+
+	try
+	{
+		const std::shared_ptr<const Context> loaded{ context(type, word_length) };
+		if (!loaded)
+			return "ERROR No words of the given length are in the dictionary.";
+
+		const Context& ctx{ *loaded };
+		WordleAI ai{ ctx.view, word_length, &ctx.index };
+
+		std::size_t turn{};
+		for (std::string guess{}, text{}; stream >> guess;)
+		{
+			if (!(stream >> text))
+				return "ERROR Every guess must be followed by its results.";
+
+			if (guess.size() != word_length)
+				return "ERROR Guess '" + guess + "' is the wrong length.";
+
+			if (!ctx.words.contains(guess))
+				return "ERROR Guess '" + guess + "' is not in the dictionary.";
+
+			ai.updateDictionary(Results::parse(guess, text));
+			++turn;
+		}
+
+		if (ai.dict.empty())
+			return "ERROR No words match the given results.";
+
+		return std::string(ai.makeGuess(turn)) + ' ' + std::to_string(ai.dict.size());
+	}
+	catch (const std::exception& ex)
+	{
+		return std::string("ERROR ") + ex.what();
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::string SolverServer::stats()
+{
+	std::vector<double> sorted{};
+	std::size_t count{};
+	double longest{};
+	{
+		const std::lock_guard lock{ latencies_mutex };
+		sorted = latencies;
+		count = request_count;
+		longest = max_latency;
+	}
+
+	std::ostringstream stream{};
+	stream << "requests " << count;
+
+	if (!sorted.empty())
+	{
+		std::sort(sorted.begin(), sorted.end());
+
+		const auto percentile = [&](const double p) { return sorted[std::size_t(p * double(sorted.size() - 1))]; };
+
+		stream << " p50_us " << percentile(0.50) << " p90_us " << percentile(0.90) << " p99_us " << percentile(0.99) << " max_us " << longest;
+	}
+	return stream.str();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void SolverServer::record(const double latency)
+{
+	const std::lock_guard lock{ latencies_mutex };
+	++request_count;
+	max_latency = std::max(max_latency, latency);
+
+	// Reservoir sampling: once the sample is full, the nth request replaces a random entry with a chance of latency_samples / n,
+	// which keeps every request equally likely to be in the sample.
+	if (latencies.size() < latency_samples)
+	{
+		latencies.push_back(latency);
+	}
+	else if (const std::size_t slot{ std::size_t(latency_random() % request_count) }; slot < latency_samples)
+	{
+		latencies[slot] = latency;
+	}
+}
+
+// ================================================================================================================================ //
+
+void SolverServer::stop()
+{
+#ifndef _WIN32
+	{
+		// The flag is set under the same lock that connections are opened with, so no connection is opened after the sweep.
+		const std::lock_guard lock{ open_mutex };
+		stopping = true;
+
+		// Only reading is shut down, so that a worker that is still answering (such as the one answering the shutdown) can reply.
+		::shutdown(listener, SHUT_RDWR);
+		for (const int connection : open_connections)
+			::shutdown(connection, SHUT_RD);
+	}
+#endif
+
+	// The queue's lock is taken so that a worker cannot miss the notification between checking the flag and waiting.
+	{
+		const std::lock_guard lock{ connections_mutex };
+	}
+	connections_ready.notify_all();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool SolverServer::open(const int connection)
+{
+	const std::lock_guard lock{ open_mutex };
+	if (stopping)
+		return false;
+
+	open_connections.insert(connection);
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void SolverServer::close([[maybe_unused]] const int connection)
+{
+	{
+		const std::lock_guard lock{ open_mutex };
+		open_connections.erase(connection);
+	}
+#ifndef _WIN32
+	::close(connection);
+#endif
+}
+
+// ================================================================================================================================ //
+
+std::shared_ptr<const SolverServer::Context> SolverServer::context(const DictType type, const std::size_t word_length)
+{
+	// The slot is shared, so it outlives the lock that finds it (even if it is removed from the map meanwhile).
+	std::shared_ptr<ContextSlot> slot{};
+	{
+		const std::lock_guard lock{ contexts_mutex };
+
+		std::shared_ptr<ContextSlot>& entry{ contexts[{ type, word_length }] };
+		if (!entry)
+			entry = std::make_shared<ContextSlot>();
+
+		slot = entry;
+	}
+
+	// Requests for the same Dictionary wait for the one that loads it, and every other Dictionary stays available meanwhile.
+	std::call_once(slot->loaded, [&]
+	{
+		Dictionary dict{ load_guesses(type, word_length, true) };
+		if (!dict.empty())
+			slot->ctx = std::make_shared<const Context>(std::move(dict));
+	});
+
+	// A length without any words is removed again, so that requests for made-up lengths do not fill the map.
+	if (!slot->ctx)
+	{
+		const std::lock_guard lock{ contexts_mutex };
+
+		const auto it{ contexts.find({ type, word_length }) };
+		if (it != contexts.end() && it->second == slot)
+			contexts.erase(it);
+	}
+	return slot->ctx;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void SolverServer::serve([[maybe_unused]] const int connection)
+{
+#ifndef _WIN32
+	std::string buffer{};
+	char chunk[4096];
+
+	// The bytes before this point are known not to hold a newline, so only the new bytes are searched.
+	std::size_t scanned{};
+
+	while (true)
+	{
+		const std::size_t newline{ buffer.find('\n', scanned) };
+		if (newline == std::string::npos)
+		{
+			if (buffer.size() > max_request_length)
+			{
+				const std::string response{ "ERROR Request too long\n" };
+				::send(connection, response.data(), response.size(), MSG_NOSIGNAL);
+				break;
+			}
+
+			scanned = buffer.size();
+
+			const ssize_t received{ ::recv(connection, chunk, sizeof(chunk), 0) };
+			if (received <= 0) break;
+
+			buffer.append(chunk, std::size_t(received));
+			continue;
+		}
+
+		std::string request{ buffer.substr(0, newline) };
+		buffer.erase(0, newline + 1);
+		scanned = 0;
+
+		if (!request.empty() && request.back() == '\r')
+			request.pop_back();
+
+		const auto start_time{ std::chrono::steady_clock::now() };
+		const std::string response{ handle(request) + '\n' };
+		const auto end_time{ std::chrono::steady_clock::now() };
+
+		record(std::chrono::duration<double, std::micro>{ end_time - start_time }.count());
+
+		if (::send(connection, response.data(), response.size(), MSG_NOSIGNAL) < 0)
+			break;
+	}
+
+	close(connection);
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void SolverServer::work()
+{
+	while (true)
+	{
+		int connection{};
+		{
+			std::unique_lock lock{ connections_mutex };
+			connections_ready.wait(lock, [&] { return stopping || !connections.empty(); });
+
+			if (connections.empty())
+				return;
+
+			connection = connections.front();
+			connections.pop();
+		}
+		serve(connection);
+	}
+}
+
+// ================================================================================================================================ //
+
+std::string send_request([[maybe_unused]] const std::uint16_t port, [[maybe_unused]] const std::string& request)
+{
+#ifdef _WIN32
+	throw std::runtime_error("The client is only supported on POSIX systems.");
+#else
+	const int connection{ ::socket(AF_INET, SOCK_STREAM, 0) };
+	if (connection < 0)
+		throw std::runtime_error("Unable to create client socket.");
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (::connect(connection, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0)
+	{
+		::close(connection);
+		throw std::runtime_error("Unable to connect to the server.");
+	}
+
+	const std::string line{ request + '\n' };
+	::send(connection, line.data(), line.size(), MSG_NOSIGNAL);
+
+	std::string response{};
+	char chunk[4096];
+	while (response.find('\n') == std::string::npos)
+	{
+		const ssize_t received{ ::recv(connection, chunk, sizeof(chunk), 0) };
+		if (received <= 0) break;
+
+		response.append(chunk, std::size_t(received));
+	}
+	::close(connection);
+
+	return response.substr(0, response.find('\n'));
+#endif
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <map>
+#include <set>
+#include <mutex>
+#include <queue>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <string>
+#include <thread>
+#include <condition_variable>
+
+#include "Dictionary.h"
+#include "LetterIndex.h"
+#include "WordSet.h"
+#include "Random.h"
+
+// ================================================================================================================================ //
+
+/*
+	A long-lived Solver Service that listens on a localhost TCP port.
+	Dictionaries (and their indices) are loaded once, on first use, and shared by every session.
+
+	Every request and response is a single line of text:
+	* "<Dictionary> <Word Length> [<Guess> <Results>]..."  ->  "<Next Guess> <Remaining Candidates>"
+	* "stats"                                              ->  The number of requests and their latency percentiles.
+	* "shutdown"                                           ->  Stops the server.
+	Results are written in the same format as Results::str() (Ex: "wordle 5 soare X-O-X").
+	Failed requests are answered with "ERROR <Message>" (a request longer than max_request_length also closes the connection).
+*/
+class SolverServer
+{
+private: // Data Structures
+
+	// Everything that the AI needs to play with a given Dictionary.
+	struct Context
+	{
+		const Dictionary guesses;
+		const DictionaryView view;
+		const LetterIndex index;
+		const WordSet words;
+
+		Context(Dictionary&& dict);
+	};
+
+	// A Context that is loaded once, on first use (a failed load is tried again by the next request).
+	struct ContextSlot
+	{
+		std::once_flag loaded;
+		std::shared_ptr<const Context> ctx;
+	};
+
+private: // Variables
+
+	// The port that the server listens on.
+	const std::uint16_t port;
+
+	// The number of sessions that can be handled at the same time.
+	const std::size_t thread_count;
+
+	// Loaded Dictionaries, by Dictionary Type and Word Length (lengths without any words are not kept).
+	// The lock only guards the map: each slot loads its own Context, so a cold Dictionary does not stall the sessions of the others.
+	std::map<std::pair<DictType, std::size_t>, std::shared_ptr<ContextSlot>> contexts;
+	std::mutex contexts_mutex;
+
+	// Connections that are waiting for a worker thread.
+	std::queue<int> connections;
+	std::mutex connections_mutex;
+	std::condition_variable connections_ready;
+
+	// The longest request that is read (longer requests are answered with an error, and the connection is closed).
+	static constexpr std::size_t max_request_length{ 64 * 1024 };
+
+	// The most latencies that are kept for the percentiles.
+	static constexpr std::size_t latency_samples{ 4096 };
+
+	// A uniform sample of the time taken by the requests so far (in microseconds), so that memory does not grow with the requests.
+	std::vector<double> latencies;
+	Random latency_random;
+
+	// The number of requests so far, and the longest time that one took (both exact).
+	std::size_t request_count;
+	double max_latency;
+	std::mutex latencies_mutex;
+
+	// The listening socket.
+	int listener;
+
+	// Every connection that is open (queued or being served), so that a shutdown can wake the workers that wait on them.
+	std::set<int> open_connections;
+	std::mutex open_mutex;
+
+	// Set once a shutdown has been requested.
+	std::atomic<bool> stopping;
+
+public: // Functions
+
+	// Constructs the server (it does not listen until run() is called).
+	SolverServer(const std::uint16_t port, const std::size_t thread_count);
+
+	// Listens for connections until a shutdown is requested.
+	void run();
+
+	// Handles a single request and returns the response (without a newline).
+	std::string handle(const std::string& request);
+
+	// Returns a summary of the latency of every request so far (the percentiles are estimated from a sample of them).
+	std::string stats();
+
+private: // Helper Functions
+
+	// Stops accepting connections, and shuts down every open one (so that workers blocked on idle clients return).
+	void stop();
+
+	// Adds a connection to the open ones. Returns false (and adds nothing) if the server is stopping.
+	bool open(const int connection);
+
+	// Removes a connection from the open ones and closes it.
+	void close(const int connection);
+
+	// Returns the Context for the given Dictionary (loading it if needed), or nullptr if it has no words of the given length.
+	std::shared_ptr<const Context> context(const DictType type, const std::size_t word_length);
+
+	// Adds the time taken by a request to the sample.
+	void record(const double latency);
+
+	// Reads requests from a connection and answers them until it is closed.
+	void serve(const int connection);
+
+	// Takes connections from the queue and serves them.
+	void work();
+
+};
+
+// ================================================================================================================================ //
+
+// Sends a single request to a server on localhost and returns its response.
+std::string send_request(const std::uint16_t port, const std::string& request);
+
+// ================================================================================================================================ //
@@ -0,0 +1,662 @@
+#include "Solver.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <numeric>
+#include <fstream>
+#include <sstream>
+#include <atomic>
+#include <unordered_set>
+
+#include "WordleAI.h"
+#include "Memory.h"
+
+// This Macro can be set externally with compilation flags.
+#ifndef NO_MULTITHREADING
+#  include <execution>
+#endif
+
+// ================================================================================================================================ //
+
+// Returns a Textual Representation of a Pattern (in the same format as Results::str()).
+static std::string pattern_str(Pattern pattern, const std::size_t word_length)
+{
+	constexpr std::string_view chars{ "X-O" };
+
+	std::string tmp(word_length, 0);
+	for (std::size_t i{}; i < word_length; ++i, pattern /= 3)
+	{
+		tmp[i] = chars[pattern % 3];
+	}
+	return tmp;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Scrambles the bits of a 64-bit value (SplitMix64 finalizer).
+static constexpr std::uint64_t mix(std::uint64_t x) noexcept
+{
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+// ================================================================================================================================ //
+
+Solver::Solver(const Dictionary& answers, const Dictionary& guesses, const Config& config)
+	:
+	answers{ answers }, guesses{ guesses }, config{ config },
+	word_length{ answers.empty() ? 0 : answers.front().size() }, root_turns{ config.max_turns == 0 ? unlimited_turns : config.max_turns }
+{
+	if (answers.empty() || guesses.empty())
+		throw std::runtime_error("Solver was given an empty Dictionary.");
+
+	require_same_alphabet(answers, guesses);
+
+	const auto wrong_length = [length{ word_length }](const std::string_view word) { return word.size() != length; };
+	if (std::any_of(answers.begin(), answers.end(), wrong_length) || std::any_of(guesses.begin(), guesses.end(), wrong_length))
+		throw std::runtime_error("Solver requires every word to be the same length.");
+
+	if (pattern_count(word_length) > std::numeric_limits<std::uint16_t>::max() + std::size_t(1))
+		throw std::runtime_error("Solver does not support words of this length.");
+
+	answer_guesses.reserve(answers.size());
+	for (const std::string_view answer : answers)
+	{
+		const auto it{ std::lower_bound(guesses.begin(), guesses.end(), answer) };
+		if (it == guesses.end() || *it != answer)
+			throw std::runtime_error("Solver requires every answer to be a valid guess.");
+
+		answer_guesses.push_back(static_cast<std::uint32_t>(it - guesses.begin()));
+	}
+
+	// Pre-Compute the Pattern of every guess against every answer.
+	patterns.resize(guesses.size() * answers.size());
+
+	std::vector<std::uint32_t> rows(guesses.size());
+	std::iota(rows.begin(), rows.end(), 0);
+
+#ifndef NO_MULTITHREADING
+	std::for_each(std::execution::par, rows.begin(), rows.end(), [&](const std::uint32_t g)
+#else
+	std::for_each(rows.begin(), rows.end(), [&](const std::uint32_t g)
+#endif
+	{
+		std::uint16_t* const row{ &patterns[std::size_t(g) * answers.size()] };
+		for (std::size_t a{}; a < answers.size(); ++a)
+		{
+			row[a] = static_cast<std::uint16_t>(make_pattern(guesses[g], answers[a]));
+		}
+	});
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Solver::~Solver()
+{
+	std::size_t bytes{};
+	for (const Shard& shard : table)
+	{
+		for (const auto& [key, slot] : shard.entries)
+			bytes += entry_bytes(slot.set.size());
+	}
+
+	memory_ledger().remove(Subsystem::Caches, bytes);
+}
+
+// ================================================================================================================================ //
+
+Solver::Outcome Solver::solve()
+{
+	SearchState root{ answers };
+
+	std::vector<Move> moves{ order_moves(root, root_turns) };
+	if (moves.empty())
+		throw std::runtime_error("Solver could not find any useful guesses.");
+
+	// The guess with the lowest bound bounds every strategy.
+	const Cost root_bound{ moves.front().bound };
+
+	if (config.breadth != 0 && moves.size() > config.breadth)
+		moves.resize(config.breadth);
+
+	Cost best{ infinite_cost };
+	std::uint32_t guess{ moves.front().guess };
+
+	// Resume from the results that were saved by a previous search (the sets are only valid for the same dictionaries).
+	const std::string header{ "breadth " + std::to_string(config.breadth) + " turns " + std::to_string(config.max_turns) +
+		" words " + std::to_string(answers.size()) + ' ' + std::to_string(guesses.size()) };
+
+	if (!config.checkpoint.empty())
+	{
+		std::unordered_map<std::string, std::pair<Cost, bool>> saved{};
+		std::vector<std::string> sets{};
+
+		std::ifstream file{ config.checkpoint };
+		std::string line{};
+		if (file && std::getline(file, line) && line == header)
+		{
+			while (std::getline(file, line))
+			{
+				// Saved sets start with '*', which no word does.
+				if (!line.empty() && line.front() == '*')
+				{
+					if (restore(line))
+						sets.push_back(line);
+					continue;
+				}
+
+				std::istringstream fields{ line };
+				std::string word{};
+				Cost cost{};
+				std::string kind{};
+				if (fields >> word >> cost >> kind)
+					saved[word] = { cost, kind == "exact" };
+			}
+		}
+		file.close();
+
+		std::vector<Move> pending{};
+		for (Move move : moves)
+		{
+			const auto it{ saved.find(std::string(guesses[move.guess])) };
+			if (it == saved.end())
+			{
+				pending.push_back(move);
+			}
+			else if (const auto [cost, exact] { it->second }; exact)
+			{
+				if (cost < best)
+				{
+					best = cost;
+					guess = move.guess;
+				}
+			}
+			else
+			{
+				move.bound = std::max(move.bound, cost);
+				pending.push_back(move);
+			}
+		}
+		std::stable_sort(pending.begin(), pending.end(), [](const Move& a, const Move& b) { return a.bound < b.bound; });
+		moves = std::move(pending);
+
+		// Rewrite the file so that it only holds results for the current settings.
+		checkpoint.open(config.checkpoint);
+		if (!checkpoint)
+			throw std::runtime_error("Unable to open checkpoint file.");
+
+		checkpoint << header << '\n';
+		for (const auto& [word, result] : saved)
+		{
+			checkpoint << word << ' ' << result.first << ' ' << (result.second ? "exact" : "bound") << '\n';
+		}
+		for (const std::string& set : sets)
+		{
+			checkpoint << set << '\n';
+		}
+		checkpoint.flush();
+	}
+
+	const Callback on_result = [&](const Move& move, const Cost cost, const bool exact)
+	{
+		if (!checkpoint.is_open()) return;
+
+		const std::lock_guard lock{ checkpoint_mutex };
+		checkpoint << guesses[move.guess] << ' ' << cost << ' ' << (exact ? "exact" : "bound") << std::endl;
+	};
+
+	best = select(root, moves, root_turns, infinite_cost + 1, best, guess, on_result);
+	store(root, root_turns, Entry{ best, guess, true });
+
+	if (checkpoint.is_open())
+		checkpoint.close();
+
+	const bool exact{ config.breadth == 0 };
+	return Outcome{ std::string(guesses[guess]), best, exact ? best : root_bound, exact };
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t Solver::write_strategy(std::ostream& stream)
+{
+	SearchState root{ answers };
+
+	return write_node(stream, root, root_turns, 0);
+}
+
+// ================================================================================================================================ //
+
+Pattern Solver::pattern(const std::uint32_t guess, const std::uint32_t answer) const noexcept
+{
+	return patterns[std::size_t(guess) * answers.size() + answer];
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Solver::Cost Solver::search(SearchState& state, const std::size_t turns_left, const Cost beta)
+{
+	// Sets of 2 or fewer candidates are solved by their lower bound.
+	const Cost floor{ lower_bound(state.size(), turns_left) };
+	if (state.size() <= 2 || floor >= beta)
+		return floor;
+
+	Entry entry{};
+	if (lookup(state, turns_left, entry) && (entry.exact || entry.cost >= beta))
+		return entry.cost;
+
+	std::vector<Move> moves{ order_moves(state, turns_left) };
+	if (moves.empty())
+		return infinite_cost;
+
+	if (config.breadth != 0 && moves.size() > config.breadth)
+		moves.resize(config.breadth);
+
+	std::uint32_t guess{ moves.front().guess };
+	const Cost cost{ select(state, moves, turns_left, beta, infinite_cost, guess) };
+
+	const Entry result{ cost, guess, cost < beta };
+	store(state, turns_left, result);
+	if (result.exact)
+		save(state, turns_left, result);
+
+	return cost;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Solver::Cost Solver::select(SearchState& state, const std::vector<Move>& moves, const std::size_t turns_left, const Cost beta, Cost best, std::uint32_t& guess, const Callback& on_result)
+{
+#ifndef NO_MULTITHREADING
+	if (state.size() >= config.parallel_threshold)
+	{
+		// The best exact cost found so far (read without locking to narrow the window of every other guess).
+		std::atomic<Cost> shared_best{ best };
+		std::mutex best_mutex{};
+
+		std::for_each(std::execution::par, moves.begin(), moves.end(), [&](const Move& move)
+		{
+			const Cost window{ std::min(shared_best.load(), beta) };
+			if (move.bound >= window)
+			{
+				const std::lock_guard lock{ best_mutex };
+				best = std::min(best, move.bound);
+				return;
+			}
+
+			// Every task branches its own copy of the state.
+			SearchState branch{ state };
+			const Cost cost{ evaluate(branch, move.guess, turns_left, window) };
+			if (on_result) on_result(move, cost, cost < window);
+
+			const std::lock_guard lock{ best_mutex };
+			best = std::min(best, cost);
+			if (cost < window && cost < shared_best.load())
+			{
+				guess = move.guess;
+				shared_best.store(cost);
+			}
+		});
+
+		return best;
+	}
+#endif
+
+	for (const Move& move : moves)
+	{
+		const Cost window{ std::min(best, beta) };
+		if (move.bound >= window)
+		{
+			// The remaining guesses are ordered by their bound, so none of them can do better.
+			best = std::min(best, move.bound);
+			break;
+		}
+
+		const Cost cost{ evaluate(state, move.guess, turns_left, window) };
+		if (on_result) on_result(move, cost, cost < window);
+
+		if (cost < best)
+		{
+			best = cost;
+			if (cost < window) guess = move.guess;
+		}
+	}
+	return best;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Solver::Cost Solver::evaluate(SearchState& state, const std::uint32_t guess, const std::size_t turns_left, const Cost beta)
+{
+	const std::vector<Group> groups{ partition(state, guess) };
+
+	// Every candidate takes this guess, then the cost of the group that it falls in.
+	Cost total{ state.size() };
+
+	Cost remaining{};
+	for (const Group& group : groups)
+	{
+		remaining += lower_bound(group.size, next_turn(turns_left));
+	}
+
+	for (const Group& group : groups)
+	{
+		if (total + remaining >= beta)
+			break;
+
+		remaining -= lower_bound(group.size, next_turn(turns_left));
+
+		const SearchState::Snapshot before{ state.snapshot() };
+		branch(state, guess, group.pattern);
+		total += search(state, next_turn(turns_left), beta - total - remaining);
+		state.rollback(before);
+	}
+
+	return std::min(total + remaining, infinite_cost);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::vector<Solver::Move> Solver::order_moves(const SearchState& state, const std::size_t turns_left) const
+{
+	const Pattern win{ winning_pattern(word_length) };
+
+	LetterCounts counts{};
+	for (const std::uint32_t answer : state)
+	{
+		WordleAI::countLetters(answers[answer], counts);
+	}
+	// The letters of the guess are scored with a single mask whenever the Alphabet fits in one.
+	const bool fits_mask{ guesses.alphabet().fits_mask() };
+	const auto score = [&](const std::string_view guess) {
+		return fits_mask ? WordleAI::scoreExplore(guess, counts, LetterMask{}) : WordleAI::scoreExplore(guess, counts, LetterSet{});
+	};
+
+	std::vector<Move> moves(guesses.size());
+
+	const auto bound_guess = [&](const std::uint32_t g) -> Move
+	{
+		thread_local std::vector<std::uint32_t> histogram{};
+		thread_local std::vector<std::uint32_t> ids{};
+		thread_local std::vector<Pattern> touched{};
+
+		histogram.resize(pattern_count(word_length));
+		ids.resize(pattern_count(word_length));
+		touched.clear();
+
+		// Guesses that split the set into the same groups (regardless of their Patterns) share a signature.
+		std::uint64_t signature{};
+		for (const std::uint32_t answer : state)
+		{
+			const Pattern p{ pattern(g, answer) };
+			if (histogram[p]++ == 0)
+			{
+				ids[p] = std::uint32_t(touched.size()) | (p == win ? 0x80000000u : 0u);
+				touched.push_back(p);
+			}
+			signature = mix(signature ^ ids[p]);
+		}
+
+		// A guess that does not split the candidates (or win) is useless.
+		const bool useful{ (touched.size() > 1) || (touched.front() == win) };
+
+		Cost bound{ state.size() };
+		for (const Pattern p : touched)
+		{
+			if (p != win) bound += lower_bound(histogram[p], next_turn(turns_left));
+			histogram[p] = 0;
+		}
+
+		if (!useful) bound = infinite_cost;
+		return Move{ std::min(bound, infinite_cost), score(guesses[g]), signature, g };
+	};
+
+	std::vector<std::uint32_t> indices(guesses.size());
+	std::iota(indices.begin(), indices.end(), 0);
+
+#ifndef NO_MULTITHREADING
+	if (state.size() >= config.parallel_threshold)
+		std::transform(std::execution::par, indices.begin(), indices.end(), moves.begin(), bound_guess);
+	else
+#endif
+		std::transform(indices.begin(), indices.end(), moves.begin(), bound_guess);
+
+	moves.erase(std::remove_if(moves.begin(), moves.end(), [](const Move& move) { return move.bound >= infinite_cost; }), moves.end());
+
+	// Lowest bound first, then the highest heuristic score (the same score that WordleAI::makeGuess() uses).
+	std::sort(moves.begin(), moves.end(), [](const Move& a, const Move& b)
+	{
+		if (a.bound != b.bound) return a.bound < b.bound;
+		if (a.score != b.score) return a.score > b.score;
+		return a.guess < b.guess;
+	});
+
+	// Only the most promising guess of each group of equivalent guesses needs to be searched.
+	std::unordered_set<std::uint64_t> signatures{};
+	moves.erase(std::remove_if(moves.begin(), moves.end(), [&](const Move& move) { return !signatures.insert(move.signature).second; }), moves.end());
+
+	return moves;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::vector<Solver::Group> Solver::partition(const SearchState& state, const std::uint32_t guess) const
+{
+	const Pattern win{ winning_pattern(word_length) };
+
+	thread_local std::vector<std::uint32_t> histogram{};
+	thread_local std::vector<Pattern> touched{};
+
+	histogram.resize(pattern_count(word_length));
+	touched.clear();
+
+	for (const std::uint32_t answer : state)
+	{
+		const Pattern p{ pattern(guess, answer) };
+		if (histogram[p]++ == 0)
+			touched.push_back(p);
+	}
+
+	// The groups are listed in order of Pattern, and the histogram is cleared for the next call.
+	std::sort(touched.begin(), touched.end());
+
+	std::vector<Group> groups{};
+	for (const Pattern p : touched)
+	{
+		if (p != win) groups.push_back(Group{ p, histogram[p] });
+		histogram[p] = 0;
+	}
+
+	// Searching the largest groups first exceeds the bound sooner.
+	std::stable_sort(groups.begin(), groups.end(), [](const Group& a, const Group& b) { return a.size > b.size; });
+
+	return groups;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void Solver::branch(SearchState& state, const std::uint32_t guess, const Pattern pattern) const
+{
+	const std::uint16_t* const row{ &patterns[std::size_t(guess) * answers.size()] };
+	state.keep_if([&](const WordID answer) { return row[answer] == pattern; });
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::uint32_t Solver::best_guess(SearchState& state, const std::size_t turns_left)
+{
+	// The candidates of a branch are in no particular order, so the lowest is picked (as it was when the sets were sorted).
+	if (state.size() <= 2)
+		return answer_guesses[*std::min_element(state.begin(), state.end())];
+
+	Entry entry{};
+	if (!lookup(state, turns_left, entry) || !entry.exact)
+	{
+		search(state, turns_left, infinite_cost + 1);
+		lookup(state, turns_left, entry);
+	}
+	return entry.guess;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t Solver::write_node(std::ostream& stream, SearchState& state, const std::size_t turns_left, const std::size_t depth)
+{
+	const std::uint32_t guess{ best_guess(state, turns_left) };
+	stream << guesses[guess] << " (" << state.size() << ")\n";
+
+	std::size_t most_turns{ depth + 1 };
+	for (const Group& group : partition(state, guess))
+	{
+		stream << std::string(2 * (depth + 1), ' ') << pattern_str(group.pattern, word_length) << ": ";
+
+		const SearchState::Snapshot before{ state.snapshot() };
+		branch(state, guess, group.pattern);
+		most_turns = std::max(most_turns, write_node(stream, state, next_turn(turns_left), depth + 1));
+		state.rollback(before);
+	}
+	return most_turns;
+}
+
+// ================================================================================================================================ //
+
+bool Solver::lookup(const SearchState& state, const std::size_t turns_left, Entry& entry)
+{
+	const std::uint64_t key{ hash(state, turns_left) };
+	Shard& shard{ table[key % table.size()] };
+
+	const std::lock_guard lock{ shard.mutex };
+	const auto it{ shard.entries.find(key) };
+	if (it == shard.entries.end() || !same_key(it->second, state, turns_left))
+		return false;
+
+	entry = it->second.entry;
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void Solver::store(const SearchState& state, const std::size_t turns_left, const Entry& entry)
+{
+	const std::uint64_t key{ hash(state, turns_left) };
+	Shard& shard{ table[key % table.size()] };
+
+	const std::lock_guard lock{ shard.mutex };
+
+	const auto it{ shard.entries.find(key) };
+	if (it == shard.entries.end())
+	{
+		// A set that is not in the table yet is dropped once the budget is spent (it is searched again if it is needed).
+		if (memory_ledger().try_add(Subsystem::Caches, entry_bytes(state.size())))
+		{
+			Candidates set(state.begin(), state.end());
+			std::sort(set.begin(), set.end());
+			shard.entries.emplace(key, Slot{ std::move(set), turns_left, entry });
+		}
+		return;
+	}
+
+	// A different key (set and turns left) with the same hash keeps its place (the new one is searched again if it is needed).
+	Slot& stored{ it->second };
+	if (!same_key(stored, state, turns_left))
+		return;
+
+	// An exact cost is never replaced by a bound.
+	if (entry.exact || !stored.entry.exact)
+		stored.entry = entry;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void Solver::save(const SearchState& state, const std::size_t turns_left, const Entry& entry)
+{
+	if (state.size() < config.checkpoint_threshold || !checkpoint.is_open())
+		return;
+
+	Candidates set(state.begin(), state.end());
+	std::sort(set.begin(), set.end());
+
+	// * <Turns Left> <Cost> <Guess> <Candidates>... (in increasing order)
+	std::ostringstream line{};
+	line << "* " << turns_left << ' ' << entry.cost << ' ' << entry.guess;
+	for (const std::uint32_t answer : set)
+	{
+		line << ' ' << answer;
+	}
+
+	const std::lock_guard lock{ checkpoint_mutex };
+	checkpoint << line.str() << std::endl;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool Solver::restore(const std::string& line)
+{
+	std::istringstream fields{ line.substr(1) };
+
+	std::size_t turns_left{};
+	Entry entry{ 0, 0, true };
+	if (!(fields >> turns_left >> entry.cost >> entry.guess) || entry.guess >= guesses.size() || entry.cost > infinite_cost)
+		return false;
+
+	// The candidates of a saved set are always in increasing order (so they can be searched with a binary search).
+	Candidates set{};
+	for (std::uint32_t answer{}; fields >> answer;)
+	{
+		if (answer >= answers.size() || (!set.empty() && answer <= set.back()))
+			return false;
+
+		set.push_back(answer);
+	}
+
+	if (!fields.eof() || set.size() < 3)
+		return false;
+
+	SearchState state{ answers };
+	state.keep_if([&](const WordID answer) { return std::binary_search(set.begin(), set.end(), answer); });
+
+	store(state, turns_left, entry);
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+bool Solver::same_key(const Slot& slot, const SearchState& state, const std::size_t turns_left) noexcept
+{
+	return (slot.turns_left == turns_left) && (slot.set.size() == state.size())
+		&& std::all_of(slot.set.begin(), slot.set.end(), [&](const std::uint32_t answer) { return state.contains(answer); });
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::uint64_t Solver::hash(const SearchState& state, const std::size_t turns_left) noexcept
+{
+	// The candidates are summed (after scrambling each one), so their order does not change the key.
+	std::uint64_t sum{};
+	for (const std::uint32_t index : state)
+	{
+		sum += mix(index + 0x9E3779B97F4A7C15ull);
+	}
+	return mix(mix(turns_left + 1) ^ sum);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::size_t Solver::next_turn(const std::size_t turns_left) noexcept
+{
+	return (turns_left == unlimited_turns) ? turns_left : turns_left - 1;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Solver::Cost Solver::lower_bound(const std::size_t size, const std::size_t turns_left) noexcept
+{
+	// At best, one candidate is guessed right away and every other candidate takes one more guess.
+	if (size == 0) return 0;
+	if (turns_left == 0) return infinite_cost;
+	if (size == 1) return 1;
+	if (turns_left == 1) return infinite_cost;
+	return 2 * Cost(size) - 1;
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,238 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <mutex>
+#include <limits>
+#include <functional>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <fstream>
+#include <unordered_map>
+
+#include "Dictionary.h"
+#include "WordleSim.h"
+#include "SearchState.h"
+
+// ================================================================================================================================ //
+
+/*
+	Searches for the Strategy Tree that minimizes the expected number of turns needed to solve every word in an answer Dictionary.
+
+	The search is a depth-first Branch-and-Bound over "guess -> partition of the candidates by Pattern":
+	* The candidates are a single SearchState, which every part of a partition is branched from and rolled back to (without copying the set).
+	* Every guess gets a lower bound from the sizes of the partitions it creates, which orders the guesses and prunes them.
+	* Solved candidate sets are cached in a Transposition Table, since different guess orders often lead to the same set
+	  (every entry keeps its whole set, and new sets are only cached while the global MemoryLedger has budget left for them).
+	* Large candidate sets search their guesses in parallel, sharing the best total found so far. The parallel algorithms
+	  nest, so every large set in a subtree splits its guesses again, and the threads of the work-stealing scheduler behind
+	  std::execution::par (TBB's) take the subtrees from each other.
+	* The results of the guesses at the root, and every large set that was solved exactly, are written to a checkpoint file.
+	  An interrupted search resumes from it: finished guesses are skipped, and the saved sets are loaded into the Transposition Table.
+*/
+class Solver
+{
+public: // Data Structures
+
+	// Total number of turns needed to solve a set of candidates (summed over every candidate).
+	using Cost = std::uint64_t;
+
+	// Cost of a set of candidates that cannot be solved in the remaining turns.
+	static constexpr Cost infinite_cost{ std::numeric_limits<std::uint32_t>::max() };
+
+	// Number of turns left when the number of turns is not limited.
+	static constexpr std::size_t unlimited_turns{ std::numeric_limits<std::size_t>::max() };
+
+	// Settings that control the search.
+	struct Config
+	{
+		// Maximum number of turns that a game may take (0 removes the limit, like the games in test_ai() that continue until they are won).
+		std::size_t max_turns{ 0 };
+
+		// Only the best N guesses (by lower bound) are searched at each step (0 searches every guess, which proves optimality).
+		std::size_t breadth{ 0 };
+
+		// Candidate sets of at least this size search their guesses in parallel.
+		std::size_t parallel_threshold{ 64 };
+
+		// File that the progress at the root is saved to and resumed from (empty disables checkpointing).
+		std::string checkpoint{};
+
+		// Candidate sets of at least this size are saved to the checkpoint once they are solved exactly.
+		std::size_t checkpoint_threshold{ 64 };
+	};
+
+	// The outcome of a search.
+	struct Outcome
+	{
+		// The best first guess.
+		std::string guess;
+
+		// Total number of turns the best strategy needs to solve every answer.
+		Cost total_turns;
+
+		// A proven lower bound on the total number of turns any strategy needs.
+		Cost lower_bound;
+
+		// Whether or not the strategy was proven to be optimal.
+		bool exact;
+	};
+
+private: // Data Structures
+
+	// Indices of the answers that are still possible.
+	using Candidates = std::vector<std::uint32_t>;
+
+	// Cached result for a candidate set.
+	struct Entry
+	{
+		// Either the exact cost of the set, or a lower bound on it.
+		Cost cost;
+
+		// The best guess found for the set.
+		std::uint32_t guess;
+
+		// Whether or not the cost is exact.
+		bool exact;
+	};
+
+	// A part of a partition: the Pattern that its candidates give, and the number of them.
+	struct Group
+	{
+		Pattern pattern;
+		std::size_t size;
+	};
+
+	// A set in the Transposition Table: the candidates and the turns that were left (different keys can share a hash), and their Entry.
+	struct Slot
+	{
+		Candidates set;
+		std::size_t turns_left;
+		Entry entry;
+	};
+
+	// A section of the Transposition Table with its own lock.
+	struct Shard
+	{
+		std::mutex mutex;
+		std::unordered_map<std::uint64_t, Slot> entries;
+	};
+
+	// A guess along with its lower bound for a given candidate set.
+	struct Move
+	{
+		Cost bound;
+		std::size_t score;
+		std::uint64_t signature;
+		std::uint32_t guess;
+	};
+
+	// Called with every guess that was searched, its cost, and whether that cost is exact (or only a lower bound).
+	using Callback = std::function<void(const Move&, const Cost, const bool)>;
+
+private: // Variables
+
+	const Dictionary& answers;
+	const Dictionary& guesses;
+	const Config config;
+
+	// Number of letters in every word.
+	const std::size_t word_length;
+
+	// Number of turns left at the start of a game.
+	const std::size_t root_turns;
+
+	// Pattern of every guess against every answer (indexed by [guess * answers.size() + answer]).
+	std::vector<std::uint16_t> patterns;
+
+	// Index of each answer in the guess Dictionary.
+	std::vector<std::uint32_t> answer_guesses;
+
+	// The Transposition Table.
+	std::array<Shard, 64> table;
+
+	// The checkpoint file (while a search is running), and its lock.
+	std::ofstream checkpoint;
+	std::mutex checkpoint_mutex;
+
+public: // Functions
+
+	// Constructs the Solver (every answer must also be a valid guess).
+	Solver(const Dictionary& answers, const Dictionary& guesses, const Config& config);
+
+	// Gives the memory of the Transposition Table back to the global MemoryLedger.
+	~Solver();
+
+	// Runs the search.
+	Outcome solve();
+
+	// Writes the best strategy that was found as a tree of guesses and returns the most turns it takes (must be called after solve()).
+	std::size_t write_strategy(std::ostream& stream);
+
+private: // Helper Functions
+
+	// Returns the Pattern of the guess against the answer.
+	Pattern pattern(const std::uint32_t guess, const std::uint32_t answer) const noexcept;
+
+	// Returns the cost of the candidates, or a lower bound that is at least beta if they cannot be solved for less than beta.
+	// Every function that takes the SearchState branches it, and rolls it back to the same candidates before it returns.
+	Cost search(SearchState& state, const std::size_t turns_left, const Cost beta);
+
+	// Searches the given guesses for the candidates and returns the cost of the best one (or a lower bound that is at least beta).
+	Cost select(SearchState& state, const std::vector<Move>& moves, const std::size_t turns_left, const Cost beta, Cost best, std::uint32_t& guess, const Callback& on_result = nullptr);
+
+	// Returns the cost of guessing the given word for the candidates, or a lower bound that is at least beta.
+	Cost evaluate(SearchState& state, const std::uint32_t guess, const std::size_t turns_left, const Cost beta);
+
+	// Returns every useful guess for the candidates, ordered from most to least promising.
+	std::vector<Move> order_moves(const SearchState& state, const std::size_t turns_left) const;
+
+	// Returns the groups that the guess splits the candidates into, largest first (the winning Pattern is excluded).
+	std::vector<Group> partition(const SearchState& state, const std::uint32_t guess) const;
+
+	// Removes the candidates that do not give the Pattern for the guess (rolled back with the Snapshot taken before it).
+	void branch(SearchState& state, const std::uint32_t guess, const Pattern pattern) const;
+
+	// Returns the best guess for the candidates (searching them again if they were not cached).
+	std::uint32_t best_guess(SearchState& state, const std::size_t turns_left);
+
+	// Writes the strategy for the candidates as a tree and returns the most turns it takes.
+	std::size_t write_node(std::ostream& stream, SearchState& state, const std::size_t turns_left, const std::size_t depth);
+
+
+	// Looks up the candidates in the Transposition Table.
+	bool lookup(const SearchState& state, const std::size_t turns_left, Entry& entry);
+
+	// Stores the candidates in the Transposition Table (sorted, so that the checkpoint and the table share one form of every set).
+	void store(const SearchState& state, const std::size_t turns_left, const Entry& entry);
+
+	// Writes the candidates, which were solved exactly, to the checkpoint (if there are enough of them to be worth saving).
+	void save(const SearchState& state, const std::size_t turns_left, const Entry& entry);
+
+	// Loads a set that was written by save() back into the Transposition Table, and returns false if the line is not valid.
+	bool restore(const std::string& line);
+
+	// Returns true if the Slot holds exactly the candidates, with the same number of turns left.
+	static bool same_key(const Slot& slot, const SearchState& state, const std::size_t turns_left) noexcept;
+
+	// Returns the Transposition Table key for the candidates (which does not depend on their order in the SearchState).
+	static std::uint64_t hash(const SearchState& state, const std::size_t turns_left) noexcept;
+
+	// Returns the bytes that an entry of the Transposition Table for a set of the given size takes up (with the node that holds it).
+	static constexpr std::size_t entry_bytes(const std::size_t size) noexcept
+	{
+		return sizeof(std::pair<const std::uint64_t, Slot>) + 2 * sizeof(void*) + size * sizeof(std::uint32_t);
+	}
+
+	// Returns the number of turns left after the next guess.
+	static std::size_t next_turn(const std::size_t turns_left) noexcept;
+
+	// Returns a lower bound on the cost of a set of the given size.
+	static Cost lower_bound(const std::size_t size, const std::size_t turns_left) noexcept;
+
+};
+
+// ================================================================================================================================ //
@@ -0,0 +1,581 @@
+#include "Verify.h"
+#include "WordleAI.h"
+#include "WordSet.h"
+#include "Dawg.h"
+#include "PatternCache.h"
+#include "SearchState.h"
+#include "LetterIndex.h"
+#include "Random.h"
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <iterator>
+
+// This Macro can be set externally with compilation flags.
+#ifndef NO_MULTITHREADING
+#  include <execution>
+#endif
+
+// ================================================================================================================================ //
+
+// A game to verify: the guesses, then the answer, then other words that may or may not be candidates (every word has the same length).
+struct Case
+{
+	std::vector<std::string> words;
+	std::size_t guess_count;
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the Pattern of the Feedback that the reference engine gives for the guess.
+static Pattern reference_pattern(const std::string_view guess, const std::string_view answer)
+{
+	const Results feedback{ WordleSim{ answer }.make_guess(guess) };
+
+	Pattern pattern{};
+	Pattern digit{ 1 };
+	for (const Feedback f : feedback)
+	{
+		pattern += digit * Pattern(f.result);
+		digit *= 3;
+	}
+	return pattern;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns a Textual Representation of a case.
+static std::string describe(const Case& c)
+{
+	std::ostringstream text{};
+	text << "guesses [";
+	for (std::size_t i{}; i < c.guess_count; ++i)
+		text << (i ? " " : "") << c.words[i];
+
+	text << "], answer " << c.words[c.guess_count] << ", other words [";
+	for (std::size_t i{ c.guess_count + 1 }; i < c.words.size(); ++i)
+		text << (i > c.guess_count + 1 ? " " : "") << c.words[i];
+
+	text << ']';
+	return text.str();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the WordIDs of a set of candidates (in increasing order).
+template <class Candidates>
+static std::vector<WordID> ids_of(const Candidates& candidates)
+{
+	std::vector<WordID> ids{};
+	candidates.for_each([&](const auto id) { ids.push_back(WordID(id)); });
+
+	// The candidates of a SearchState are in no particular order once it has been branched.
+	std::sort(ids.begin(), ids.end());
+	return ids;
+}
+
+// ================================================================================================================================ //
+
+// Runs every engine on the case, and returns a description of the first mismatch with the reference (or an empty string).
+static std::string check_case(const Case& c)
+{
+	const std::size_t length{ c.words[0].size() };
+	const std::string_view answer{ c.words[c.guess_count] };
+
+	for (const std::string& guess : c.words)
+	{
+		for (const std::string& word : c.words)
+		{
+			if (make_pattern(guess, word) != reference_pattern(guess, word))
+				return "make_pattern(" + guess + ", " + word + ") does not match WordleSim";
+		}
+	}
+
+	// The engines share a Dictionary of the distinct words of the case (sorted, as the Dawg requires).
+	std::vector<std::string> distinct{ c.words };
+	std::sort(distinct.begin(), distinct.end());
+	distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+	Dictionary dict{};
+	for (const std::string& word : distinct)
+		dict.push_back(word);
+
+	// Tiles of 2 words, with room for only 2 tiles, so that most reads have to evict a tile.
+	PatternCache cache{ dict, dict, 2 * 2 * 2 * PatternCache::pattern_width(length), 2 };
+	for (WordID g{}; g < dict.size(); ++g)
+	{
+		for (WordID a{}; a < dict.size(); ++a)
+		{
+			if (cache.get(g, a) != make_pattern(dict[g], dict[a]))
+				return "PatternCache::get(" + std::string(dict[g]) + ", " + std::string(dict[a]) + ") does not match make_pattern()";
+		}
+	}
+
+	const WordSet set{ dict };
+	for (WordID id{}; id < dict.size(); ++id)
+	{
+		if (set.find(dict[id]) != id)
+			return "WordSet::find(" + std::string(dict[id]) + ") does not return its WordID";
+	}
+	if (set.contains(std::string(answer) + 'a') || set.contains(std::string(answer).substr(1)))
+		return "WordSet::contains() finds a word that is not in the Dictionary";
+
+	const DictionaryView view{ dict };
+	const LetterIndex index{ dict };
+	const Dawg dawg{ dict };
+
+	WordleAI reference{ view, length };
+	WordleAI indexed{ view, length, &index };
+	SearchState state{ indexed.branch() };
+	WordConstraints constraints{ length };
+
+	// Every guess is a branch of its own, so rolling back to the start undoes all of them at once (and restores the exact order).
+	const SearchState::Snapshot start{ state.snapshot() };
+	const std::vector<WordID> initial{ ids_of(state) };
+
+	for (std::size_t i{}; i < c.guess_count; ++i)
+	{
+		const Results feedback{ WordleSim{ answer }.make_guess(c.words[i]) };
+		reference.updateDictionary(feedback);
+		indexed.updateDictionary(feedback);
+		state.apply(feedback);
+		constraints.add(feedback);
+	}
+
+	// A word is a candidate by definition if every guess would have given it the same Feedback as the answer.
+	std::vector<WordID> defined{};
+	for (WordID id{}; id < dict.size(); ++id)
+	{
+		const bool consistent{ dict[id].size() == length && std::all_of(c.words.begin(), c.words.begin() + c.guess_count,
+			[&](const std::string& guess) { return reference_pattern(guess, dict[id]) == reference_pattern(guess, answer); }) };
+
+		if (consistent)
+			defined.push_back(id);
+	}
+
+	std::vector<WordID> expected{};
+	for (const WordID id : reference.dict)
+		expected.push_back(id);
+
+	if (defined != expected)
+		return "updateDictionary() does not keep exactly the words that give the same Feedback as the answer";
+	if (ids_of(indexed.dict.words()) != expected)
+		return "updateDictionary() with a LetterIndex does not match updateDictionary() without one";
+	if (ids_of(state) != expected || ids_of(state.words()) != expected)
+		return "SearchState::apply() does not match updateDictionary()";
+	if (dawg.matching(constraints) != expected)
+		return "Dawg::matching() does not match updateDictionary()";
+
+	state.rollback(start);
+	if (!std::equal(state.begin(), state.end(), initial.begin(), initial.end()) || ids_of(state.words()) != initial)
+		return "SearchState::rollback() does not restore the candidates from before the guesses";
+
+	return "";
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Shrinks a failing case to one that cannot be made any smaller (or simpler) while still failing.
+static Case shrink(Case c)
+{
+	const auto try_change = [&](Case changed)
+	{
+		if (check_case(changed).empty())
+			return false;
+
+		c = std::move(changed);
+		return true;
+	};
+
+	for (bool shrunk{ true }; shrunk;)
+	{
+		shrunk = false;
+
+		// Fewer words.
+		for (std::size_t i{ c.words.size() }; i-- > 0 && !shrunk;)
+		{
+			if (i == c.guess_count || (i < c.guess_count && c.guess_count == 1)) continue;
+
+			Case changed{ c };
+			changed.words.erase(changed.words.begin() + std::ptrdiff_t(i));
+			changed.guess_count -= (i < c.guess_count) ? 1 : 0;
+			shrunk = try_change(std::move(changed));
+		}
+
+		// Shorter words (the same letter is removed from every word).
+		for (std::size_t p{}; p < c.words[0].size() && c.words[0].size() > 1 && !shrunk; ++p)
+		{
+			Case changed{ c };
+			for (std::string& word : changed.words)
+				word.erase(p, 1);
+			shrunk = try_change(std::move(changed));
+		}
+
+		// Simpler letters (each letter is replaced by an earlier one).
+		for (std::size_t w{}; w < c.words.size() && !shrunk; ++w)
+		{
+			for (std::size_t p{}; p < c.words[w].size() && !shrunk; ++p)
+			{
+				for (char letter{ 'a' }; letter < c.words[w][p] && !shrunk; ++letter)
+				{
+					Case changed{ c };
+					changed.words[w][p] = letter;
+					shrunk = try_change(std::move(changed));
+				}
+			}
+		}
+	}
+	return c;
+}
+
+// ================================================================================================================================ //
+
+// Collects the mismatches of a check (from any thread), and prints the first few of them shrunk to minimal cases.
+class Failures
+{
+private: // Variables
+
+	// The most mismatches that are shrunk and printed for a single check.
+	static constexpr std::size_t max_printed{ 5 };
+
+	std::mutex mutex;
+	std::vector<std::pair<std::string, Case>> cases;
+	std::size_t total;
+
+public: // Functions
+
+	Failures() : mutex{}, cases{}, total{} {}
+
+	// Records a mismatch.
+	void add(const std::string& description, const Case& c)
+	{
+		const std::lock_guard lock{ mutex };
+		++total;
+		if (cases.size() < max_printed)
+			cases.emplace_back(description, c);
+	}
+
+	// Prints the result of the check, and returns the number of mismatches.
+	std::size_t report(const std::size_t checked, const double seconds)
+	{
+		if (total == 0)
+		{
+			std::cout << "OK (" << checked << " checked in " << seconds << " s)\n";
+			return 0;
+		}
+
+		std::cout << "FAILED (" << total << " of " << checked << " mismatched)\n";
+		for (const auto& [description, c] : cases)
+		{
+			std::cout << "  * " << description << "\n    Case: " << describe(c) << '\n';
+
+			// Cases from the whole Dictionary may only fail alongside the rest of it.
+			if (!check_case(c).empty())
+			{
+				const Case minimal{ shrink(c) };
+				std::cout << "    Minimal Case: " << describe(minimal) << "\n    (" << check_case(minimal) << ")\n";
+			}
+		}
+		return total;
+	}
+
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Calls the function with every index below the count (split between threads).
+template <class Function>
+static void for_each_index(const std::size_t count, Function&& function)
+{
+	std::vector<std::size_t> indices(count);
+	std::iota(indices.begin(), indices.end(), 0);
+
+#ifndef NO_MULTITHREADING
+	std::for_each(std::execution::par, indices.begin(), indices.end(), function);
+#else
+	std::for_each(indices.begin(), indices.end(), function);
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the seconds since the given time.
+static double seconds_since(const std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>{ std::chrono::steady_clock::now() - start }.count();
+}
+
+// ================================================================================================================================ //
+
+std::size_t verify_engines(const VerifyOptions& options)
+{
+	const Dictionary answers{ load_answers(DictType::Wordle) };
+	const Dictionary all_guesses{ load_guesses(DictType::Wordle) };
+	const Dictionary scrabble{ load_answers(DictType::Scrabble) };
+
+	Dictionary guesses{};
+	guesses.set_alphabet(all_guesses.shared_alphabet());
+	{
+		Random random{ options.seed };
+		std::vector<std::string_view> sample{};
+		std::sample(all_guesses.begin(), all_guesses.end(), std::back_inserter(sample), options.guesses, random);
+		for (const std::string_view guess : sample)
+			guesses.push_back(guess);
+	}
+
+	std::size_t failures{};
+
+	std::cout << "\n========================== WORDLE AI  VERIFY =========================\n\n";
+	std::cout << "Checking " << answers.size() << " Wordle answers against " << guesses.size() << " guesses (Seed: " << options.seed << ")...\n\n";
+
+	// Feedback: make_pattern() and the PatternCache against WordleSim, for every pair.
+	{
+		std::cout << "Feedback of every pair...   " << std::flush;
+		const auto start{ std::chrono::steady_clock::now() };
+
+		PatternCache cache{ guesses, answers, 1 << 20 };
+		Failures found{};
+
+		for_each_index(guesses.size(), [&](const std::size_t g)
+		{
+			for (WordID a{}; a < answers.size(); ++a)
+			{
+				const Pattern expected{ reference_pattern(guesses[g], answers[a]) };
+
+				if (make_pattern(guesses[g], answers[a]) != expected)
+					found.add("make_pattern() does not match WordleSim", Case{ { std::string(guesses[g]), std::string(answers[a]) }, 1 });
+				else if (cache.get(WordID(g), a) != expected)
+					found.add("PatternCache::get() does not match WordleSim", Case{ { std::string(guesses[g]), std::string(answers[a]) }, 1 });
+			}
+		});
+
+		failures += found.report(guesses.size() * answers.size(), seconds_since(start));
+	}
+
+	// Games: every answer is played the way play_sim() plays it, from guesses typed in uppercase, until the answer itself is typed.
+	{
+		std::cout << "Games from typed guesses... " << std::flush;
+		const auto start{ std::chrono::steady_clock::now() };
+
+		Failures found{};
+		for_each_index(answers.size(), [&](const std::size_t a)
+		{
+			const std::string_view answer{ answers[a] };
+			WordleSim sim{ answer };
+
+			// A few guesses from the sample (the same ones for every answer), then the answer.
+			for (std::size_t g{}; g < std::min<std::size_t>(guesses.size(), 3); ++g)
+			{
+				std::string typed{ guesses[g] };
+				make_uppercase(typed);
+
+				const Results feedback{ sim.make_guess(typed) };
+				if (reference_pattern(typed, answer) != reference_pattern(guesses[g], answer) || feedback.is_won() != (guesses[g] == answer))
+				{
+					found.add("WordleSim::make_guess() does not ignore the case of the guess", Case{ { std::string(guesses[g]), std::string(answer) }, 1 });
+					return;
+				}
+			}
+
+			std::string typed{ answer };
+			make_uppercase(typed);
+			if (!sim.make_guess(typed).is_won())
+				found.add("WordleSim::make_guess() does not win the game when the answer is typed in uppercase", Case{ { std::string(answer), std::string(answer) }, 1 });
+		});
+
+		failures += found.report(answers.size(), seconds_since(start));
+	}
+
+	// Filtering: every engine against updateDictionary() without an index, for every Feedback that each guess can give.
+	{
+		std::cout << "Candidates after a guess... " << std::flush;
+		const auto start{ std::chrono::steady_clock::now() };
+
+		const DictionaryView view{ answers };
+		const LetterIndex index{ answers };
+		const Dawg dawg{ answers };
+		const WordleAI reference_start{ view, default_length };
+		const WordleAI indexed_start{ view, default_length, &index };
+
+		Failures found{};
+		std::atomic<std::size_t> checked{};
+
+		for_each_index(guesses.size(), [&](const std::size_t g)
+		{
+			const std::string_view guess{ guesses[g] };
+
+			// The answers that give the same Feedback are exactly the candidates that should be left after it.
+			std::map<Pattern, std::vector<WordID>> classes{};
+			for (WordID a{}; a < answers.size(); ++a)
+				classes[reference_pattern(guess, answers[a])].push_back(a);
+
+			SearchState state{ indexed_start.branch() };
+			for (const auto& [pattern, expected] : classes)
+			{
+				const std::string_view answer{ answers[expected.front()] };
+				const Results feedback{ WordleSim{ answer }.make_guess(guess) };
+
+				WordleAI reference{ reference_start };
+				WordleAI indexed{ indexed_start };
+				reference.updateDictionary(feedback);
+				indexed.updateDictionary(feedback);
+
+				const SearchState::Snapshot before{ state.snapshot() };
+				state.apply(feedback);
+
+				WordConstraints constraints{ default_length };
+				constraints.add(feedback);
+
+				const std::vector<WordID> results[]{ ids_of(reference.dict.words()), ids_of(indexed.dict.words()), ids_of(state), dawg.matching(constraints) };
+				constexpr const char* names[]{ "updateDictionary()", "updateDictionary() with a LetterIndex", "SearchState::apply()", "Dawg::matching()" };
+
+				for (std::size_t r{}; r < std::size(results); ++r)
+				{
+					if (results[r] == expected) continue;
+
+					// The case holds a word that one of the two sets has and the other does not.
+					std::vector<WordID> difference{};
+					std::set_symmetric_difference(results[r].begin(), results[r].end(), expected.begin(), expected.end(), std::back_inserter(difference));
+
+					found.add(std::string(names[r]) + " does not keep exactly the words that give the same Feedback as the answer",
+						Case{ { std::string(guess), std::string(answer), std::string(answers[difference.front()]) }, 1 });
+				}
+
+				state.rollback(before);
+				++checked;
+			}
+		});
+
+		failures += found.report(checked, seconds_since(start));
+	}
+
+	// Partitions: the histograms of WordleAI against the Patterns of every candidate counted one at a time, after every first guess.
+	{
+		std::cout << "Partitions of candidates... " << std::flush;
+		const auto start{ std::chrono::steady_clock::now() };
+
+		const DictionaryView view{ answers };
+		const LetterIndex index{ answers };
+		const WordleAI start_ai{ view, default_length, &index };
+
+		// A cache with room for a small part of the matrix, so that the threads keep evicting each other's Tiles.
+		PatternCache cache{ answers, answers, 64 * 1024 };
+
+		// The guesses that split each set of candidates (words of the answers, as the AI only guesses words of its Dictionary).
+		std::vector<WordID> probes(8);
+		{
+			Random random{ options.seed + 1 };
+			for (WordID& probe : probes)
+				probe = WordID(random() % answers.size());
+		}
+
+		Failures found{};
+		std::atomic<std::size_t> checked{};
+
+		for_each_index(guesses.size(), [&](const std::size_t g)
+		{
+			const std::string_view guess{ guesses[g] };
+
+			std::map<Pattern, WordID> classes{};
+			for (WordID a{}; a < answers.size(); ++a)
+				classes.emplace(reference_pattern(guess, answers[a]), a);
+
+			for (const auto& [pattern, answer] : classes)
+			{
+				WordleAI ai{ start_ai };
+				ai.updateDictionary(WordleSim{ answers[answer] }.make_guess(guess));
+
+				WordleAI cached_ai{ ai };
+				cached_ai.pattern_cache = &cache;
+
+				const std::vector<Histogram> batch{ ai.partitions(probes) };
+				const std::vector<Histogram> cached_batch{ cached_ai.partitions(probes) };
+				for (std::size_t p{}; p < probes.size(); ++p)
+				{
+					Histogram expected(pattern_count(default_length));
+					for (const WordID id : ai.dict)
+						++expected[make_pattern(answers[probes[p]], answers[id])];
+
+					const char* const mismatch{
+						(batch[p] != expected) ? "WordleAI::partitions()" :
+						(cached_batch[p] != expected) ? "WordleAI::partitions() with a PatternCache" :
+						(p == 0 && ai.partition(probes[p]) != expected) ? "WordleAI::partition()" :
+						(p == 0 && cached_ai.partition(probes[p]) != expected) ? "WordleAI::partition() with a PatternCache" : nullptr
+					};
+					if (mismatch)
+						found.add(std::string(mismatch) + " does not count the Patterns of the candidates", Case{ { std::string(guess), std::string(answers[answer]), std::string(answers[probes[p]]) }, 1 });
+				}
+				checked += probes.size();
+			}
+		});
+
+		failures += found.report(checked, seconds_since(start));
+	}
+
+	// Fuzzing: random cases of every length, from Scrabble words and from words made of only a few letters.
+	{
+		std::vector<std::vector<std::string_view>> words_of_length(16);
+		for (const std::string_view word : scrabble)
+		{
+			if (word.size() < words_of_length.size())
+				words_of_length[word.size()].push_back(word);
+		}
+
+		for (std::size_t length{ 2 }; length <= 15; ++length)
+		{
+			std::cout << "Random cases of length " << length << (length < 10 ? ":  " : ": ") << std::flush;
+			const auto start{ std::chrono::steady_clock::now() };
+
+			Failures found{};
+			for_each_index(options.cases_per_length, [&](const std::size_t i)
+			{
+				// Every case has its own generator, so the cases do not depend on the threads.
+				Random random{ options.seed * 0x9E3779B97F4A7C15ull + length * 1000003 + i };
+				const std::vector<std::string_view>& scrabble_words{ words_of_length[length] };
+
+				// Words made from at most 4 letters repeat letters often, which is where Feedback is the hardest to get right.
+				std::string letters{ "abcdefghijklmnopqrstuvwxyz" };
+				std::shuffle(letters.begin(), letters.end(), random);
+				letters.resize(2 + random() % 3);
+
+				Case c{ {}, 1 + random() % 3 };
+				const std::size_t word_count{ c.guess_count + 1 + random() % 8 };
+
+				for (std::size_t w{}; w < word_count; ++w)
+				{
+					if (!scrabble_words.empty() && random() % 2 == 0)
+					{
+						c.words.emplace_back(scrabble_words[random() % scrabble_words.size()]);
+					}
+					else
+					{
+						std::string word(length, ' ');
+						for (char& chr : word)
+							chr = letters[random() % letters.size()];
+						c.words.push_back(word);
+					}
+				}
+
+				if (const std::string mismatch{ check_case(c) }; !mismatch.empty())
+					found.add(mismatch, c);
+			});
+
+			failures += found.report(options.cases_per_length, seconds_since(start));
+		}
+	}
+
+	std::cout << '\n' << (failures == 0 ? "Every engine matches the reference." : "Some engines do NOT match the reference.") << '\n';
+	std::cout << "\n======================================================================\n\n";
+
+	return failures;
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// ================================================================================================================================ //
+
+// Settings for verify_engines().
+struct VerifyOptions
+{
+	// Number of Wordle guesses that are checked against every Wordle answer.
+	std::size_t guesses{ 200 };
+
+	// Number of random cases that are fuzzed for each word length (from 2 to 15).
+	std::size_t cases_per_length{ 2000 };
+
+	// Seed of the random guesses and cases (the same seed always checks the same cases).
+	std::uint64_t seed{ 1 };
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+/*
+	Checks every optimized engine against the reference engine, and prints each mismatch that it finds (shrunk to a minimal case).
+
+	The reference is WordleSim::make_guess() for Feedback, and WordleAI::updateDictionary() without an index for filtering.
+	The engines checked against them are make_pattern(), the PatternCache, the LetterIndex (through WordleAI and SearchState),
+	the partition histograms of WordleAI, the Dawg and the WordSet, as well as the definition itself (a word is a candidate if it would give the same Feedback as the answer).
+	Every Wordle answer is also played as a game from guesses typed in uppercase, which has to end once the answer is typed.
+
+	The Wordle answers are checked exhaustively against a sample of guesses, and random cases (Scrabble words, and words made from a few
+	letters to force repeated letters) are fuzzed for every length from 2 to 15. Returns the number of mismatches.
+*/
+std::size_t verify_engines(const VerifyOptions& options = {});
+
+// ================================================================================================================================ //
@@ -0,0 +1,139 @@
+#include "WordSet.h"
+
+#include <stdexcept>
+#include <algorithm>
+
+// ================================================================================================================================ //
+
+// Returns true if the number is prime.
+static bool is_prime(const std::size_t number) noexcept
+{
+	if (number < 2) return false;
+
+	for (std::size_t divisor{ 2 }; divisor * divisor <= number; ++divisor)
+	{
+		if (number % divisor == 0) return false;
+	}
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+WordSet::WordSet(const Dictionary& dict)
+	:
+	dict{ dict }, seed{}, displacements{}, slots{}
+{
+	std::size_t table_size{ std::max<std::size_t>(dict.size(), 2) };
+	while (!is_prime(table_size)) ++table_size;
+
+	// Buckets hold 4 words on average, which keeps the search for displacements short.
+	displacements.resize(std::max<std::size_t>(dict.size() / 4, 1));
+
+	// If a bucket cannot be placed within this many displacements, the whole table is rebuilt with another seed.
+	// Displacements repeat the same slots every table_size steps, so trying more than that would never help.
+	const std::uint32_t max_displacement{ std::uint32_t(std::min<std::size_t>(table_size, 1u << 20)) };
+
+	for (;; ++seed)
+	{
+		std::vector<std::vector<WordID>> buckets(displacements.size());
+		std::vector<std::uint64_t> hashes(dict.size());
+
+		for (std::size_t id{}; id < dict.size(); ++id)
+		{
+			hashes[id] = hash(dict[id]);
+			std::vector<WordID>& words{ buckets[bucket(hashes[id])] };
+
+			// Repeated words keep the first WordID.
+			if (std::none_of(words.begin(), words.end(), [&](const WordID other) { return dict[other] == dict[id]; }))
+				words.push_back(static_cast<WordID>(id));
+		}
+
+		// The largest buckets are the hardest to place, so they are placed first, while most slots are still free.
+		std::vector<std::size_t> order(buckets.size());
+		for (std::size_t b{}; b < order.size(); ++b) order[b] = b;
+		std::stable_sort(order.begin(), order.end(), [&](const std::size_t a, const std::size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+		slots.assign(table_size, not_found);
+		bool built{ true };
+
+		std::vector<std::size_t> taken{};
+		for (const std::size_t b : order)
+		{
+			const std::vector<WordID>& words{ buckets[b] };
+			if (words.empty()) break;
+
+			std::uint32_t displacement{};
+			for (; displacement < max_displacement; ++displacement)
+			{
+				taken.clear();
+				const bool fits{ std::all_of(words.begin(), words.end(), [&](const WordID id) {
+					const std::size_t s{ slot(hashes[id], displacement) };
+					if (slots[s] != not_found || std::find(taken.begin(), taken.end(), s) != taken.end())
+						return false;
+					taken.push_back(s);
+					return true;
+				}) };
+
+				if (fits) break;
+			}
+
+			if (displacement == max_displacement)
+			{
+				built = false;
+				break;
+			}
+
+			displacements[b] = displacement;
+			for (std::size_t i{}; i < words.size(); ++i)
+				slots[taken[i]] = words[i];
+		}
+
+		if (built) break;
+	}
+}
+
+// ================================================================================================================================ //
+
+WordID WordSet::find(const std::string_view word) const noexcept
+{
+	const std::uint64_t h{ hash(word) };
+	const WordID id{ slots[slot(h, displacements[bucket(h)])] };
+
+	return (id != not_found && dict[id] == word) ? id : not_found;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::uint64_t WordSet::hash(const std::string_view word) const noexcept
+{
+	// FNV-1a over the characters, followed by a SplitMix64 finalizer so that every bit of the result depends on every character.
+	std::uint64_t h{ 0xCBF29CE484222325ull ^ (seed * 0x9E3779B97F4A7C15ull) };
+	for (const char chr : word)
+	{
+		h ^= static_cast<unsigned char>(chr);
+		h *= 0x100000001B3ull;
+	}
+
+	h ^= h >> 30;
+	h *= 0xBF58476D1CE4E5B9ull;
+	h ^= h >> 27;
+	h *= 0x94D049BB133111EBull;
+	h ^= h >> 31;
+	return h;
+}
+
+// ================================================================================================================================ //
+
+const std::string& pick_word(const WordSet& words, const std::string& word)
+{
+	if (!words.contains(word))
+	{
+		throw std::runtime_error("Given word was not found in Dictionary.");
+	}
+	else
+	{
+		return word;
+	}
+}
+
+// ================================================================================================================================ //
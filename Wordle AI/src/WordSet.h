@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <vector>
+#include <string>
+#include <string_view>
+
+#include "Dictionary.h"
+
+// ================================================================================================================================ //
+
+/*
+	A Perfect Hash Table of the words of a Dictionary, for checking if a word is valid in constant time.
+
+	Words are hashed into small buckets, and every bucket is given a displacement that sends each of its words to its own slot
+	(the "Hash and Displace" method). A lookup is then two hashes, one slot, and a single comparison against the word in that slot,
+	with no probing and no chains. The table has one slot per word (rounded up to a prime), and holds only WordIDs.
+
+	It never changes after being built, so one set can be shared by every thread that uses the same Dictionary.
+*/
+class WordSet
+{
+public: // Data Structures
+
+	// Returned by find() for words that are not in the set.
+	static constexpr WordID not_found{ std::numeric_limits<WordID>::max() };
+
+private: // Variables
+
+	// The Dictionary that the words are from.
+	const Dictionary& dict;
+
+	// Seed of the hash function (changed until every word gets its own slot).
+	std::uint64_t seed;
+
+	// [Bucket] -> Displacement of the words in the bucket.
+	std::vector<std::uint32_t> displacements;
+
+	// [Slot] -> WordID of the word in the slot (or not_found if it is empty).
+	std::vector<WordID> slots;
+
+public: // Functions
+
+	// Builds the set for the given Dictionary (which must outlive the set).
+	explicit WordSet(const Dictionary& dict);
+
+	// Returns the WordID of the word, or not_found if it is not in the Dictionary.
+	WordID find(const std::string_view word) const noexcept;
+
+	// Returns true if the word is in the Dictionary.
+	inline bool contains(const std::string_view word) const noexcept
+	{
+		return find(word) != not_found;
+	}
+
+private: // Helper Functions
+
+	// Returns the hash of the word (with the current seed).
+	std::uint64_t hash(const std::string_view word) const noexcept;
+
+	// Returns the bucket of a hash.
+	inline std::size_t bucket(const std::uint64_t h) const noexcept
+	{
+		return std::size_t((h >> 32) % displacements.size());
+	}
+
+	// Returns the slot of a hash with the given displacement.
+	inline std::size_t slot(const std::uint64_t h, const std::uint64_t displacement) const noexcept
+	{
+		// The table size is prime, so every step size visits every slot.
+		const std::uint64_t start{ std::uint32_t(h) % slots.size() };
+		const std::uint64_t step{ 1 + (h >> 40) % (slots.size() - 1) };
+		return std::size_t((start + displacement * step) % slots.size());
+	}
+
+};
+
+// ================================================================================================================================ //
+
+// Verifies that the word is actually in the dictionary before returning it.
+const std::string& pick_word(const WordSet& words, const std::string& word);
+
+// ================================================================================================================================ //
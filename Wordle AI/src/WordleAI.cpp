@@ -1,42 +1,67 @@
 #include "WordleAI.h"
 
-#include <iostream>
 #include <algorithm>
+#include <numeric>
+#include <limits>
 #include <iterator>
 #include <random>
+#include <chrono>
+#include <cmath>
+#include <type_traits>
 
 #include "WordleSim.h"
+#include "Random.h"
+
+// This Macro can be set externally with compilation flags.
+#ifndef NO_MULTITHREADING
+#  include <execution>
+#  include <thread>
+#endif
 
 // ================================================================================================================================ //
 
-WordleAI::WordleAI(const DictionaryView& dict_g, const std::size_t word_length)
-	:
-	dict{ dict_g }, full_dict{ dict_g }, invalidated{}
+// Returns the words of the DictionaryView with the given length.
+static CandidateSet starting_candidates(const DictionaryView& dict_g, const std::size_t word_length, const LetterIndex* const index)
 {
-	dict.erase_if([=](const std::string* const word) { return word->size() != word_length; });
+	// When the view holds the whole indexed Dictionary, the index already has the set, so it only needs to be copied.
+	if (index && (&index->dictionary() == &dict_g.dictionary()) && (dict_g.size() == dict_g.dictionary().size()))
+		return CandidateSet(dict_g.dictionary(), index->with_length(word_length));
+
+	return CandidateSet(dict_g, [&](const WordID id) { return dict_g.word(id).size() == word_length; });
 }
 
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+WordleAI::WordleAI(const DictionaryView& dict_g, const std::size_t word_length, const LetterIndex* const index)
+	:
+	dict{ starting_candidates(dict_g, word_length, index) }, full_dict{ dict_g }, index{ index }, invalidated{}, lookahead{}, sampling{}, pattern_cache{ nullptr }
+{}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+WordleAI::WordleAI(const WordleAI& other, const DictionaryView& dict_g, const LetterIndex* const index)
+	:
+	dict{ dict_g.dictionary(), other.dict.words() }, full_dict{ dict_g }, index{ index }, invalidated{ other.invalidated }, lookahead{ other.lookahead },
+	sampling{ other.sampling }, pattern_cache{ other.pattern_cache }
+{}
+
 // ================================================================================================================================ //
 
-const std::string& WordleAI::makeGuess([[maybe_unused]] const std::size_t try_count)
+std::string_view WordleAI::makeGuess([[maybe_unused]] const std::size_t try_count)
 {
 	if (dict.empty())
 		throw std::runtime_error("AI Dictionary is empty.");
 
 	std::size_t topValue{};
-	const std::string* bestGuess{ dict.front() };
-	const std::size_t word_length{ bestGuess->size() };
+	WordID bestGuess{ dict.front() };
+	const std::size_t word_length{ dict.word(bestGuess).size() };
 
-	size_t lettersMap[26]{};
+	LetterCounts lettersMap{};
 
-	for (const std::string* const word : dict)
+	for (const WordID id : dict)
 	{
 		//let's count the letters. 
-		for (const char ch : *word)
-		{
-			//yeah, increment the thing. woop!
-			++lettersMap[ch - 'a'];
-		}
+		countLetters(dict.word(id), lettersMap);
 	}
 
 	const std::ptrdiff_t remaining_turns{ 6 - std::ptrdiff_t(try_count) };
@@ -46,81 +71,155 @@ const std::string& WordleAI::makeGuess([[maybe_unused]] const std::size_t try_co
 
 	if (use_alt)
 	{
-		for (const std::string* const word : full_dict)
-		{
-			if (word->size() != word_length) continue;
-
-			bool lettersFound[26]{};
-
-			std::size_t value{};
-			for (const char ch : *word)
+		with_letters([&](const auto& letters) {
+			for (const WordID id : full_dict)
 			{
-				const std::size_t index{ std::size_t(ch - 'a') };
+				const std::string_view word{ full_dict.word(id) };
+				if (word.size() != word_length) continue;
 
-				bool& found{ lettersFound[index] };
+				const std::size_t value{ scoreExplore(word, lettersMap, letters) };
 
-				if (!invalidated[index])
+				if (value >= topValue)
 				{
-					value += lettersMap[index] / (found ? 2 : 1);
+					bestGuess = id;
+					topValue = value;
 				}
+			}
+		});
+	}
+	else
+	{
+		with_letters([&](const auto& letters) {
+			using Letters = std::decay_t<decltype(letters)>;
 
-				if (!found)
+			for (const WordID id : dict)
+			{
+				const std::size_t value{ scoreCandidate<Letters>(dict.word(id), lettersMap) };
+
+				if (value > topValue)
 				{
-					found = true;
-					value += 7;
+					bestGuess = id;
+					topValue = value;
 				}
 			}
+		});
+	}
 
-			if (value >= topValue)
-			{
-				bestGuess = word;
-				topValue = value;
-			}
-		}
+	if (use_alt && (sampling.breadth != 0))
+	{
+		bestGuess = rankGuess(bestGuess, lettersMap);
 	}
-	else
+
+	// Near the end of the game, a guess that looks worse now can still solve more words in the turns that are left.
+	if (use_alt && (lookahead.breadth != 0) && (remaining_turns <= 3))
 	{
-		for (const std::string* const word : dict)
+		bestGuess = planGuess(bestGuess, std::size_t(remaining_turns), lettersMap);
+	}
+
+	return dict.word(bestGuess);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::vector<Suggestion> WordleAI::suggestGuesses(const std::size_t try_count, const std::size_t count) const
+{
+	if (dict.empty())
+		throw std::runtime_error("AI Dictionary is empty.");
+
+	const std::size_t word_length{ dict.word(dict.front()).size() };
+
+	LetterCounts lettersMap{};
+	for (const WordID id : dict)
+	{
+		countLetters(dict.word(id), lettersMap);
+	}
+
+	// The guesses are scored the same way as in makeGuess(): exploring guesses from the full Dictionary, or candidates near the end.
+	const std::ptrdiff_t remaining_turns{ 6 - std::ptrdiff_t(try_count) };
+	const bool use_alt{ (remaining_turns > 1) && (std::ptrdiff_t(dict.size()) > remaining_turns) };
+
+	// Ties go to the last exploring guess or the first candidate, as they do in makeGuess().
+	using Scored = std::pair<std::size_t, WordID>;
+	const auto better = [=](const Scored& a, const Scored& b) {
+		return (a.first > b.first) || (a.first == b.first && (use_alt ? (a.second > b.second) : (a.second < b.second)));
+	};
+
+	// Only the best guesses so far are kept, in a heap with the worst of them on top (rather than sorting every guess).
+	std::vector<Scored> best{};
+	best.reserve(std::min(count, full_dict.size()) + 1);
+
+	const auto offer = [&](const std::size_t score, const WordID id)
+	{
+		if (best.size() == count && !better(Scored{ score, id }, best.front()))
+			return;
+
+		best.emplace_back(score, id);
+		std::push_heap(best.begin(), best.end(), better);
+
+		if (best.size() > count)
 		{
-			bool lettersFound[26]{};
+			std::pop_heap(best.begin(), best.end(), better);
+			best.pop_back();
+		}
+	};
 
-			std::size_t value{};
-			for (const char ch : *word)
+	if (use_alt)
+	{
+		with_letters([&](const auto& letters) {
+			for (const WordID id : full_dict)
 			{
-				const std::size_t index{ std::size_t(ch - 'a') };
-
-				bool& found{ lettersFound[index] };
-				if (!found)
-				{
-					found = true;
-					value += lettersMap[index];
-				}
+				const std::string_view word{ full_dict.word(id) };
+				if (word.size() == word_length)
+					offer(scoreExplore(word, lettersMap, letters), id);
 			}
+		});
+	}
+	else
+	{
+		with_letters([&](const auto& letters) {
+			using Letters = std::decay_t<decltype(letters)>;
 
-			if (value > topValue)
+			for (const WordID id : dict)
 			{
-				bestGuess = word;
-				topValue = value;
+				offer(scoreCandidate<Letters>(dict.word(id), lettersMap), id);
 			}
-		}
+		});
 	}
 
-	return *bestGuess;
+	std::sort_heap(best.begin(), best.end(), better);
+
+	std::vector<Suggestion> suggestions(best.size());
+	std::transform(best.begin(), best.end(), suggestions.begin(), [&](const Scored& scored) {
+		return Suggestion{ full_dict.word(scored.second), scored.first, dict.contains(scored.second) };
+	});
+	return suggestions;
 }
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
-const std::string& WordleAI::randomGuess()
+std::string_view WordleAI::randomGuess()
 {
-	const std::string* guess{};
-	std::sample(dict.begin(), dict.end(), &guess, 1, std::random_device{});
-	return *guess;
+	std::uniform_int_distribution<std::size_t> distribution{ 0, dict.size() - 1 };
+	return dict.word(*std::next(dict.begin(), std::ptrdiff_t(distribution(thread_random()))));
 }
 
 // ================================================================================================================================ //
 
 void WordleAI::updateDictionary(const Results& feedback)
 {
+	if (index)
+	{
+		for (const Feedback f : feedback)
+		{
+			if (f.result == Result::Invalid)
+				invalidated.insert(letter_index(f.letter));
+		}
+
+		// Every constraint is applied to the whole set of candidates at once, a block of words at a time.
+		dict.modify([&](Bitset& words) { index->filter(feedback, words); });
+		return;
+	}
+
 	for (std::size_t i{}; i < feedback.size(); i++)
 	{
 		const Feedback f{ feedback[i] };
@@ -128,7 +227,7 @@ void WordleAI::updateDictionary(const Results& feedback)
 		const Result result{ f.result };
 		
 		if (result == Result::Invalid)
-			invalidated[letter - 'a'] = true;
+			invalidated.insert(letter_index(letter));
 
 		// Number of non-invalid occurrences of the current letter in the guess.
 		const auto count{ std::count_if(feedback.begin(), feedback.end(),
@@ -139,24 +238,27 @@ void WordleAI::updateDictionary(const Results& feedback)
 		{
 			case Result::Correct:
 			{
-				dict.erase_if([=](const std::string* const word) {
-					return ((*word)[i] != letter) || (std::count(word->begin(), word->end(), letter) < count);
+				dict.erase_if([&](const WordID id) {
+					const std::string_view word{ dict.word(id) };
+					return (word[i] != letter) || (std::count(word.begin(), word.end(), letter) < count);
 				});
 			}
 			break;
 
 			case Result::Exists:
 			{
-				dict.erase_if([=](const std::string* const word) {
-					return ((*word)[i] == letter) || (std::count(word->begin(), word->end(), letter) < count);
+				dict.erase_if([&](const WordID id) {
+					const std::string_view word{ dict.word(id) };
+					return (word[i] == letter) || (std::count(word.begin(), word.end(), letter) < count);
 				});
 			}
 			break;
 
 			case Result::Invalid:
 			{
-				dict.erase_if([=](const std::string* const word) {
-					return ((*word)[i] == letter) || (std::count(word->begin(), word->end(), letter) != count);
+				dict.erase_if([&](const WordID id) {
+					const std::string_view word{ dict.word(id) };
+					return (word[i] == letter) || (std::count(word.begin(), word.end(), letter) != count);
 				});
 			}
 			break;
@@ -165,4 +267,536 @@ void WordleAI::updateDictionary(const Results& feedback)
 	}
 }
 
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+SearchState WordleAI::branch() const
+{
+	if (!index)
+		throw std::runtime_error("Branching requires a LetterIndex of the Dictionary.");
+
+	return SearchState(*index, dict, invalidated);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the (up to) count words of the given length with the highest scores, best first (ties go to the lowest WordID).
+template<class View, class Score>
+static std::vector<WordID> best_guesses(const View& view, const std::size_t word_length, const std::size_t count, const Score& score)
+{
+	std::vector<std::pair<std::size_t, WordID>> scored{};
+	for (const WordID id : view)
+	{
+		const std::string_view word{ view.word(id) };
+		if (word.size() == word_length)
+			scored.emplace_back(score(word), id);
+	}
+
+	const std::size_t best_count{ std::min(count, scored.size()) };
+	std::partial_sort(scored.begin(), scored.begin() + best_count, scored.end(), [](const auto& a, const auto& b) {
+		return (a.first > b.first) || (a.first == b.first && a.second < b.second);
+	});
+
+	std::vector<WordID> best(best_count);
+	std::transform(scored.begin(), scored.begin() + best_count, best.begin(), [](const auto& pair) { return pair.second; });
+	return best;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+WordID WordleAI::rankGuess(const WordID greedy, const LetterCounts& counts) const
+{
+	const auto deadline{ std::chrono::steady_clock::now() + std::chrono::duration<double, std::milli>{ sampling.budget } };
+
+	const Dictionary& words{ dict.dictionary() };
+	const std::size_t word_length{ words[greedy].size() };
+
+	// The chance that two different candidates give the same Pattern (its estimate, and the standard error of the estimate).
+	// The expected number of candidates left after a guess is 1 + (N - 1) * collisions, so a lower value is a better guess.
+	struct Estimate
+	{
+		WordID guess;
+		double collisions;
+		double error;
+	};
+
+	std::vector<Estimate> estimates{ Estimate{ greedy, 0.0, 0.0 } };
+	const std::vector<WordID> best{ with_letters([&](const auto& letters) {
+		return best_guesses(full_dict, word_length, sampling.breadth, [&](const std::string_view word) { return scoreExplore(word, counts, letters); });
+	}) };
+
+	for (const WordID id : best)
+	{
+		if (id != greedy)
+			estimates.push_back(Estimate{ id, 0.0, 0.0 });
+	}
+
+	// Every sample is a prefix of the candidates in a random order, so a larger sample still holds the answers that were already scored.
+	std::vector<WordID> answers(dict.begin(), dict.end());
+	const bool exact{ answers.size() <= sampling.exact_limit };
+
+	if (!exact)
+	{
+		// The order only depends on the seed and the candidates, so that games in the same state still make the same guess.
+		Random generator{ random_seed() ^ (std::uint64_t(answers.size()) << 32) ^ (std::uint64_t(answers.front()) << 16) ^ answers.back() };
+		std::shuffle(answers.begin(), answers.end(), generator);
+	}
+
+	std::size_t sample_size{ exact ? answers.size() : std::max<std::size_t>(sampling.exact_limit / 4, 64) };
+	std::vector<Pattern> patterns{};
+	std::vector<WordID> guesses{};
+	std::vector<WordID> sample{};
+
+	while (true)
+	{
+		const double m{ double(sample_size) };
+
+		// The cache reads answers in increasing order a Tile at a time, so it is given the sample sorted (the order does not change the groups).
+		sample.assign(answers.begin(), answers.begin() + sample_size);
+		if (pattern_cache)
+			std::sort(sample.begin(), sample.end());
+
+		// Estimates the collisions of a guess from the size of every group of sampled answers that share a Pattern (in order of Pattern).
+		const auto estimate_from = [&](Estimate& estimate, const auto& for_each_group)
+		{
+			// Every sampled answer in a group of k shares its Pattern with (k - 1) of the other (m - 1) answers.
+			double sum{};
+			double squares{};
+			for_each_group([&](const double k)
+			{
+				const double share{ (k - 1.0) / (m - 1.0) };
+
+				sum += k * share;
+				squares += k * share * share;
+			});
+
+			estimate.collisions = sum / m;
+			estimate.error = (sample_size == answers.size()) ? 0.0 : std::sqrt(std::max(squares / m - estimate.collisions * estimate.collisions, 0.0) / m);
+		};
+
+		if (word_length <= max_histogram_length)
+		{
+			guesses.clear();
+			for (const Estimate& estimate : estimates)
+				guesses.push_back(estimate.guess);
+
+			const std::vector<Histogram> histograms{ partitionAnswers(guesses, sample.data(), sample.data() + sample.size()) };
+
+			for (std::size_t i{}; i < estimates.size(); ++i)
+			{
+				estimate_from(estimates[i], [&](const auto& add_group)
+				{
+					for (const std::uint32_t k : histograms[i])
+					{
+						if (k != 0)
+							add_group(double(k));
+					}
+				});
+			}
+		}
+		else
+		{
+			for (Estimate& estimate : estimates)
+			{
+				if (pattern_cache)
+				{
+					pattern_cache->get_row(estimate.guess, sample.data(), sample.data() + sample.size(), patterns);
+				}
+				else
+				{
+					const std::string_view guess{ words[estimate.guess] };
+
+					patterns.clear();
+					for (const WordID id : sample)
+						patterns.push_back(make_pattern(guess, words[id]));
+				}
+				std::sort(patterns.begin(), patterns.end());
+
+				estimate_from(estimate, [&](const auto& add_group)
+				{
+					for (auto first{ patterns.begin() }; first != patterns.end();)
+					{
+						const auto last{ std::upper_bound(first, patterns.end(), *first) };
+						add_group(double(last - first));
+						first = last;
+					}
+				});
+			}
+		}
+
+		// The first guess (in the order of the heuristic scores) wins ties.
+		const Estimate leader{ *std::min_element(estimates.begin(), estimates.end(), [](const Estimate& a, const Estimate& b) { return a.collisions < b.collisions; }) };
+
+		if (sample_size == answers.size() || std::chrono::steady_clock::now() > deadline)
+			return leader.guess;
+
+		// Guesses that are behind the leader by more than the confidence margin are dropped.
+		const double z{ sampling.confidence };
+		estimates.erase(std::remove_if(estimates.begin(), estimates.end(), [&](const Estimate& estimate) {
+			return (estimate.collisions - z * estimate.error) > (leader.collisions + z * leader.error);
+		}), estimates.end());
+
+		if (estimates.size() == 1)
+			return leader.guess;
+
+		sample_size = std::min(sample_size * 2, answers.size());
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+WordID WordleAI::planGuess(const WordID greedy, const std::size_t turns, const LetterCounts& counts) const
+{
+	const auto deadline{ std::chrono::steady_clock::now() + std::chrono::duration<double, std::milli>{ lookahead.budget } };
+
+	const Dictionary& words{ dict.dictionary() };
+	const std::size_t word_length{ words[greedy].size() };
+
+	// Move Ordering: the best guesses by the same scores that the greedy guess is picked with.
+	const std::vector<WordID> explore{ with_letters([&](const auto& letters) {
+		return best_guesses(full_dict, word_length, lookahead.breadth, [&](const std::string_view word) { return scoreExplore(word, counts, letters); });
+	}) };
+	const std::vector<WordID> candidates{ with_letters([&](const auto& letters) {
+		using Letters = std::decay_t<decltype(letters)>;
+		return best_guesses(dict, word_length, lookahead.breadth, [&](const std::string_view word) { return scoreCandidate<Letters>(word, counts); });
+	}) };
+
+	std::vector<WordID> moves{ greedy };
+	for (const std::vector<WordID>* list : { &candidates, &explore })
+	{
+		for (const WordID id : *list)
+		{
+			if (std::find(moves.begin(), moves.end(), id) == moves.end())
+				moves.push_back(id);
+		}
+	}
+
+	// The answers of every branch are the candidates of the state, so no group of answers is copied.
+	SearchState state{ dict };
+	std::vector<Pattern> patterns{};
+
+	// The Pattern of the first guess against every answer (by WordID), which the answers of each group are kept by.
+	std::vector<Pattern> first_patterns(words.size());
+
+	// Writes the Pattern of the guess against every answer in [first, last) to the given vector.
+	const auto get_patterns = [&](const WordID guess, const WordID* const first, const WordID* const last, std::vector<Pattern>& out)
+	{
+		if (pattern_cache)
+		{
+			pattern_cache->get_row(guess, first, last, out);
+			return;
+		}
+
+		const std::string_view word{ words[guess] };
+
+		out.clear();
+		for (const WordID* id{ first }; id != last; ++id)
+			out.push_back(make_pattern(word, words[*id]));
+	};
+
+	// Number of answers in [first, last) that are solved when the guess is followed by one last turn (one for every distinct result).
+	const auto one_turn_left = [&](const WordID guess, const WordID* const first, const WordID* const last)
+	{
+		get_patterns(guess, first, last, patterns);
+
+		std::sort(patterns.begin(), patterns.end());
+		return std::size_t(std::unique(patterns.begin(), patterns.end()) - patterns.begin());
+	};
+
+	// Set once the budget runs out in the middle of an evaluation (whose value is then only partial, and is not used).
+	bool timed_out{ false };
+	const auto out_of_time = [&]()
+	{
+		timed_out = timed_out || (std::chrono::steady_clock::now() > deadline);
+		return timed_out;
+	};
+
+	// Number of the remaining answers that are solved in two turns by the best follow-up guess (or by the ones tried before the deadline).
+	const auto two_turns_left = [&]()
+	{
+		if (state.size() <= 2)
+			return state.size();
+
+		std::size_t best{};
+		const std::pair<const WordID*, const WordID*> lists[]{ { state.begin(), state.end() }, { explore.data(), explore.data() + explore.size() } };
+		for (const auto& [first, last] : lists)
+		{
+			for (const WordID* id{ first }; id != last; ++id)
+			{
+				best = std::max(best, one_turn_left(*id, state.begin(), state.end()));
+				if (best == state.size() || out_of_time())
+					return best;
+			}
+		}
+		return best;
+	};
+
+	std::vector<std::pair<std::size_t, Pattern>> groups{};
+
+	// Number of answers that are solved by guessing the word first.
+	// Evaluation stops as soon as the guess cannot solve more than alpha (the value returned is then no more than alpha).
+	const auto evaluate = [&](const WordID guess, const std::size_t alpha)
+	{
+		if (turns == 2)
+			return one_turn_left(guess, state.begin(), state.end());
+
+		get_patterns(guess, state.begin(), state.end(), patterns);
+		for (std::size_t i{}; i < patterns.size(); ++i)
+			first_patterns[state.begin()[i]] = patterns[i];
+
+		// The size of every group of answers that share a Pattern (groups of 2 or fewer are always solved).
+		std::sort(patterns.begin(), patterns.end());
+
+		groups.clear();
+		for (auto first{ patterns.begin() }; first != patterns.end();)
+		{
+			const auto last{ std::upper_bound(first, patterns.end(), *first) };
+			if (last - first > 2)
+				groups.emplace_back(std::size_t(last - first), *first);
+			first = last;
+		}
+
+		// The largest groups are the most likely to lose answers, so they are checked first.
+		std::sort(groups.begin(), groups.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+		// Starts from the bound where every answer is solved and tightens it one group at a time.
+		std::size_t bound{ dict.size() };
+		for (const auto& [size, pattern] : groups)
+		{
+			const SearchState::Snapshot before{ state.snapshot() };
+			state.keep_if([&](const WordID id) { return first_patterns[id] == pattern; });
+
+			bound -= size - two_turns_left();
+			state.rollback(before);
+
+			if (bound <= alpha || out_of_time())
+				break;
+		}
+		return bound;
+	};
+
+	// The budget is checked inside every evaluation as well as between them, so that one large group cannot overrun it.
+	// A guess whose evaluation runs out of time is never picked, so the greedy guess is kept unless another one was fully searched.
+	WordID best{ greedy };
+	if (out_of_time())
+		return best;
+
+	std::size_t best_solved{ evaluate(greedy, 0) };
+
+	for (std::size_t i{ 1 }; i < moves.size() && best_solved < dict.size(); ++i)
+	{
+		if (out_of_time())
+			break;
+
+		const std::size_t solved{ evaluate(moves[i], best_solved) };
+		if (timed_out)
+			break;
+
+		if (solved > best_solved)
+		{
+			best = moves[i];
+			best_solved = solved;
+		}
+	}
+
+	return best;
+}
+
+// ================================================================================================================================ //
+
+// Throws if the guess cannot be partitioned against answers of the given length.
+static void check_partition(const std::string_view guess, const std::size_t answer_length)
+{
+	if (guess.size() > max_histogram_length)
+		throw std::runtime_error("Partition histograms do not support words of this length.");
+
+	if (guess.size() != answer_length)
+		throw std::runtime_error("Partition guesses must be the same length as the candidates.");
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Counts the Pattern of the guess against every answer in [first, last) into the histogram.
+// This is scalar code: the Patterns are computed a block at a time, so that the counting loop does not wait on them.
+template<class Iterator>
+static void add_patterns(const std::string_view guess, const Dictionary& words, Iterator first, const Iterator last, Histogram& histogram)
+{
+	constexpr std::size_t block_size{ 256 };
+	Pattern patterns[block_size];
+
+	while (first != last)
+	{
+		std::size_t count{};
+		for (; count < block_size && first != last; ++count, ++first)
+			patterns[count] = make_pattern(guess, words[*first]);
+
+		for (std::size_t i{}; i < count; ++i)
+			++histogram[patterns[i]];
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void WordleAI::countPatterns(const WordID guess, const WordID* const first, const WordID* const last, Histogram& histogram) const
+{
+	const Dictionary& words{ dict.dictionary() };
+
+	if (!pattern_cache)
+	{
+		add_patterns(words[guess], words, first, last, histogram);
+		return;
+	}
+
+	std::vector<Pattern> patterns{};
+	pattern_cache->get_row(guess, first, last, patterns);
+
+	for (const Pattern pattern : patterns)
+		++histogram[pattern];
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+Histogram WordleAI::partition(const WordID guess) const
+{
+	const std::string_view word{ full_dict.word(guess) };
+	check_partition(word, dict.empty() ? word.size() : dict.word(dict.front()).size());
+
+	const std::vector<WordID> ids(dict.begin(), dict.end());
+	Histogram histogram(pattern_count(word.size()));
+
+#ifndef NO_MULTITHREADING
+	// Large sets are split between threads, each counting into its own bins, which are summed at the end.
+	constexpr std::size_t chunk_size{ 4096 };
+	const std::size_t chunk_count{ std::min<std::size_t>((ids.size() + chunk_size - 1) / chunk_size, std::max(1u, std::thread::hardware_concurrency())) };
+
+	if (chunk_count > 1)
+	{
+		std::vector<std::size_t> chunks(chunk_count);
+		std::iota(chunks.begin(), chunks.end(), 0);
+
+		std::vector<Histogram> bins(chunk_count, Histogram(histogram.size()));
+
+		std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&](const std::size_t chunk)
+		{
+			const std::size_t first{ ids.size() * chunk / chunk_count };
+			const std::size_t last{ ids.size() * (chunk + 1) / chunk_count };
+			countPatterns(guess, ids.data() + first, ids.data() + last, bins[chunk]);
+		});
+
+		for (const Histogram& bin : bins)
+		{
+			std::transform(histogram.begin(), histogram.end(), bin.begin(), histogram.begin(), std::plus<>{});
+		}
+		return histogram;
+	}
+#endif
+
+	countPatterns(guess, ids.data(), ids.data() + ids.size(), histogram);
+	return histogram;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::vector<Histogram> WordleAI::partitions(const std::vector<WordID>& guesses) const
+{
+	const std::vector<WordID> ids(dict.begin(), dict.end());
+	return partitionAnswers(guesses, ids.data(), ids.data() + ids.size());
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+std::vector<Histogram> WordleAI::partitionAnswers(const std::vector<WordID>& guesses, const WordID* const first, const WordID* const last) const
+{
+	const Dictionary& words{ dict.dictionary() };
+	std::vector<Histogram> histograms(guesses.size());
+
+	for (const WordID guess : guesses)
+	{
+		check_partition(words[guess], (first == last) ? words[guess].size() : words[*first].size());
+	}
+
+	// Every guess has its own histogram, so the bins of each thread are already private.
+	const auto count = [&](const WordID guess)
+	{
+		Histogram histogram(pattern_count(words[guess].size()));
+		countPatterns(guess, first, last, histogram);
+		return histogram;
+	};
+
+#ifndef NO_MULTITHREADING
+	std::transform(std::execution::par, guesses.begin(), guesses.end(), histograms.begin(), count);
+#else
+	std::transform(guesses.begin(), guesses.end(), histograms.begin(), count);
+#endif
+
+	return histograms;
+}
+
+// ================================================================================================================================ //
+
+void WordleAI::countLetters(const std::string_view word, LetterCounts& counts) noexcept
+{
+	for (const char ch : word)
+	{
+		//yeah, increment the thing. woop!
+		++counts[letter_index(ch)];
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+template<class Letters>
+std::size_t WordleAI::scoreExplore(const std::string_view word, const LetterCounts& counts, const Letters& invalidated) noexcept
+{
+	Letters lettersFound{};
+
+	std::size_t value{};
+	for (const char ch : word)
+	{
+		const std::size_t index{ letter_index(ch) };
+
+		const bool found{ lettersFound.contains(index) };
+
+		if (!invalidated.contains(index))
+		{
+			value += counts[index] / (found ? 2 : 1);
+		}
+
+		if (!found)
+		{
+			lettersFound.insert(index);
+			value += 7;
+		}
+	}
+	return value;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+template<class Letters>
+std::size_t WordleAI::scoreCandidate(const std::string_view word, const LetterCounts& counts) noexcept
+{
+	Letters lettersFound{};
+
+	std::size_t value{};
+	for (const char ch : word)
+	{
+		const std::size_t index{ letter_index(ch) };
+
+		if (!lettersFound.contains(index))
+		{
+			lettersFound.insert(index);
+			value += counts[index];
+		}
+	}
+	return value;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Both types of letter sets are built here (the Solver scores guesses with them too).
+template std::size_t WordleAI::scoreExplore<LetterMask>(const std::string_view, const LetterCounts&, const LetterMask&) noexcept;
+template std::size_t WordleAI::scoreExplore<LetterSet>(const std::string_view, const LetterCounts&, const LetterSet&) noexcept;
+template std::size_t WordleAI::scoreCandidate<LetterMask>(const std::string_view, const LetterCounts&) noexcept;
+template std::size_t WordleAI::scoreCandidate<LetterSet>(const std::string_view, const LetterCounts&) noexcept;
+
 // ================================================================================================================================ //
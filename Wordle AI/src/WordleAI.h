@@ -1,12 +1,70 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
+#include <array>
+#include <vector>
 #include <string>
+#include <string_view>
 #include <algorithm>
 
 #include "Dictionary.h"
 #include "WordleSim.h"
+#include "LetterIndex.h"
+#include "CandidateSet.h"
+#include "SearchState.h"
+#include "PatternCache.h"
+
+// ================================================================================================================================ //
+
+// Number of times each letter occurs across a set of words (indexed by letter index).
+using LetterCounts = std::array<std::size_t, max_letters>;
+
+// Number of words that give each Pattern (indexed by Pattern).
+using Histogram = std::vector<std::uint32_t>;
+
+// The longest words that a Histogram can be made for (3^10 Patterns, the most that fit in 16 bits).
+inline constexpr std::size_t max_histogram_length{ 10 };
+
+// Settings for the optional Lookahead of WordleAI::makeGuess().
+struct Lookahead
+{
+	// Number of guesses (the best by the heuristic scores) that are searched two turns ahead (0 disables the lookahead).
+	std::size_t breadth{};
+
+	// The longest that the search may take on a single turn (in milliseconds).
+	double budget{ 10.0 };
+};
+
+// Settings for the optional Sampled Scoring of WordleAI::makeGuess().
+struct Sampling
+{
+	// Number of guesses (the best by scoreExplore) that are ranked by how evenly they split the candidates (0 disables the ranking).
+	std::size_t breadth{};
+
+	// Candidate sets up to this size are scored exactly; larger sets are scored from a random sample that grows until the leader is clear.
+	std::size_t exact_limit{ 1024 };
+
+	// The leader is clear once no other guess could beat it within this many standard errors (higher is more accurate, but slower).
+	double confidence{ 2.0 };
+
+	// The longest that the sampling may take on a single turn (in milliseconds).
+	double budget{ 20.0 };
+};
+
+// A guess ranked by WordleAI::suggestGuesses().
+struct Suggestion
+{
+	// The suggested guess.
+	std::string_view word;
+
+	// The heuristic score that the guess was ranked by (higher is better).
+	std::size_t score;
+
+	// True if the guess is one of the remaining candidates (so it could win this turn).
+	bool candidate;
+};
 
 // ================================================================================================================================ //
 
@@ -18,29 +76,105 @@ class WordleAI
 {
 public: // Variables
 
-	// The Dictionary holding valid guesses.
-	DictionaryView dict;
+	// The Dictionary holding valid guesses (the words of full_dict that are still possible answers).
+	CandidateSet dict;
 
 	// The Original DictionaryView that was used to start the AI.
 	const DictionaryView& full_dict;
 
-	// Array of characters that have been invalidated in the current game.
-	bool invalidated[26];
+	// Index of the Dictionary that full_dict refers to (optional, speeds up updateDictionary()).
+	const LetterIndex* index;
+
+	// Letters that have been invalidated in the current game.
+	LetterSet invalidated;
+
+	// Settings for searching ahead near the end of the game (disabled by default).
+	Lookahead lookahead;
+
+	// Settings for ranking the exploring guesses by how they split the candidates (disabled by default).
+	Sampling sampling;
+
+	// Cache of the Patterns between words of the Dictionary (optional, shared by the partitions, the sampling and the lookahead of every game).
+	PatternCache* pattern_cache;
 
 public: // Functions
 
-	// Constructs the AI with the given Dictionary.
-	WordleAI(const DictionaryView& dict_g, const std::size_t word_length);
+	// Constructs the AI with the given Dictionary (and optionally an index of the Dictionary that it points into).
+	WordleAI(const DictionaryView& dict_g, const std::size_t word_length, const LetterIndex* const index = nullptr);
+
+	// Constructs a copy of the AI that reads a copy of its Dictionary (with the same words) and the index of that copy instead.
+	WordleAI(const WordleAI& other, const DictionaryView& dict_g, const LetterIndex* const index);
 
 	// Returns a Guess from the Dictionary.
-	const std::string& makeGuess(const std::size_t try_count);
+	std::string_view makeGuess(const std::size_t try_count);
+
+	// Returns the (up to) count best guesses by the same scores as makeGuess(), best first.
+	// The best is the guess that makeGuess() makes when the sampling and the lookahead are disabled.
+	std::vector<Suggestion> suggestGuesses(const std::size_t try_count, const std::size_t count) const;
 
 	// Returns a Random Word from the Dictionary.
-	const std::string& randomGuess();
+	std::string_view randomGuess();
 
 	// Analyzes the Feedback from the Results of the previous guess and updates the Dictionary accordingly.
 	void updateDictionary(const Results& feedback);
 
+	// Returns a copy of the current game state that can be branched and rolled back cheaply (requires an index).
+	SearchState branch() const;
+
+	// Returns how the guess (a word of the Dictionary) splits the remaining candidates: the number of candidates that give each Pattern.
+	// Words longer than max_histogram_length have too many Patterns, and throw.
+	Histogram partition(const WordID guess) const;
+
+	// Returns the partition() of every guess (the guesses are split between threads).
+	std::vector<Histogram> partitions(const std::vector<WordID>& guesses) const;
+
+	// Returns the number of bytes that the state of the game takes up (the Dictionary, the index and the cache are shared).
+	inline std::size_t memory_usage() const noexcept
+	{
+		return dict.memory_usage();
+	}
+
+public: // Heuristics
+
+	// Adds the letters of the given word to the letter counts.
+	static void countLetters(const std::string_view word, LetterCounts& counts) noexcept;
+
+	// Scores a word for gathering information while many candidates remain (letters that are already invalidated are ignored).
+	// Letters is the type of the letter sets: LetterMask if the Alphabet fits in one (the fast path), or else LetterSet.
+	template<class Letters>
+	static std::size_t scoreExplore(const std::string_view word, const LetterCounts& counts, const Letters& invalidated) noexcept;
+
+	// Scores a word for picking among the remaining candidates (with the same type of letter sets as scoreExplore()).
+	template<class Letters>
+	static std::size_t scoreCandidate(const std::string_view word, const LetterCounts& counts) noexcept;
+
+private: // Helper Functions
+
+	// Calls the function with the invalidated letters as a LetterMask if the Alphabet fits in one, or else as a LetterSet.
+	template<class Function>
+	inline auto with_letters(Function&& function) const
+	{
+		if (dict.dictionary().alphabet().fits_mask())
+			return function(LetterMask{ invalidated });
+
+		return function(invalidated);
+	}
+
+	// Counts the Pattern of the guess against every answer in [first, last) into the histogram (read through the pattern_cache, if there is one).
+	void countPatterns(const WordID guess, const WordID* const first, const WordID* const last, Histogram& histogram) const;
+
+	// Returns how every guess splits the given answers (words of the Dictionary), like partitions() does for the candidates.
+	std::vector<Histogram> partitionAnswers(const std::vector<WordID>& guesses, const WordID* const first, const WordID* const last) const;
+
+	// Ranks the best exploring guesses by the expected number of candidates left after them, and returns the best.
+	// Large candidate sets are scored from a random sample, which grows until the ranking of the leader is confident.
+	// The sample is split by the partition histograms of the guesses (or by sorting their Patterns, for words that are too long).
+	WordID rankGuess(const WordID greedy, const LetterCounts& counts) const;
+
+	// Searches the best guesses for the one that solves the most candidates within the remaining turns (2 or 3).
+	// The greedy guess is kept unless another guess is fully searched within the budget and solves strictly more.
+	WordID planGuess(const WordID greedy, const std::size_t turns, const LetterCounts& counts) const;
+
 };
 
 // ================================================================================================================================ //
@@ -0,0 +1,465 @@
+#include "WordleCore.h"
+#include "wordle_core.h"
+
+#include <new>
+#include <memory>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+// ================================================================================================================================ //
+
+// The longest words whose Patterns fit in a Pattern (3^20 < 2^32).
+static constexpr std::size_t max_pattern_length{ 20 };
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+const char* status_message(const CoreStatus status) noexcept
+{
+	switch (status)
+	{
+	case CoreStatus::Ok:              return "OK.";
+	case CoreStatus::InvalidArgument: return "A length did not match the length of the words, or a buffer is missing.";
+	case CoreStatus::InvalidWord:     return "The guess is not in the dictionary.";
+	case CoreStatus::InvalidResults:  return "The results must only be made up of 'X', '-' and 'O'.";
+	case CoreStatus::NoCandidates:    return "No words match the given results.";
+	case CoreStatus::BufferTooSmall:  return "The buffer is too small.";
+	case CoreStatus::OutOfMemory:     return "Out of memory.";
+	case CoreStatus::Error:           return "An error occurred.";
+	}
+	return "Unknown status.";
+}
+
+// ================================================================================================================================ //
+
+CoreSolver::CoreSolver(Dictionary&& dict, const std::size_t word_length)
+	:
+	guesses{ std::move(dict) }, view{ guesses }, index{ guesses }, words{ guesses }, length{ word_length }
+{
+	if (index.with_length(length).count() == 0)
+		throw std::runtime_error("Dictionary does not contain any words of the given length.");
+}
+
+// ================================================================================================================================ //
+
+CoreGame::CoreGame(const CoreSolver& solver)
+	:
+	solver{ solver }, ai{ solver.view, solver.length, &solver.index }, start{ ai.dict }, feedback{ solver.length }, previous{ ai.dict },
+	word{}, text{}, turns{}
+{
+	// A letter takes up to 4 bytes of UTF-8.
+	word.reserve(solver.length * 4);
+	text.reserve(solver.length * 4);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void CoreGame::reset() noexcept
+{
+	// Both sets are the size of the Dictionary, so the copy reuses the AI's storage.
+	ai.dict = start;
+	ai.invalidated.clear();
+	turns = 0;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+CoreStatus CoreGame::update(const std::string_view guess, const std::string_view results) noexcept
+{
+	constexpr std::string_view chars{ "X-O" };
+
+	if (results.size() != solver.length)
+		return CoreStatus::InvalidArgument;
+
+	if (const CoreStatus status{ encode(guess) }; status != CoreStatus::Ok)
+		return status;
+
+	for (std::size_t i{}; i < results.size(); ++i)
+	{
+		const std::size_t result_i{ chars.find(results[i] == 'x' ? 'X' : (results[i] == 'o' ? 'O' : results[i])) };
+		if (result_i == std::string_view::npos)
+			return CoreStatus::InvalidResults;
+
+		feedback[i] = Feedback{ word[i], Result(result_i) };
+	}
+	return apply();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+CoreStatus CoreGame::update(const std::string_view guess, Pattern pattern) noexcept
+{
+	if (solver.length > max_pattern_length)
+		return CoreStatus::InvalidArgument;
+
+	if (const CoreStatus status{ encode(guess) }; status != CoreStatus::Ok)
+		return status;
+
+	if (pattern >= pattern_count(solver.length))
+		return CoreStatus::InvalidResults;
+
+	for (std::size_t i{}; i < word.size(); ++i, pattern /= 3)
+	{
+		feedback[i] = Feedback{ word[i], Result(pattern % 3) };
+	}
+	return apply();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+CoreStatus CoreGame::guess(std::string_view& guess) noexcept
+{
+	// The candidates are never left empty, and the AI only allocates when sampling or looking ahead (which are disabled).
+	try
+	{
+		text.clear();
+		solver.guesses.alphabet().decode(ai.makeGuess(turns), text);
+
+		guess = text;
+		return CoreStatus::Ok;
+	}
+	catch (...)
+	{
+		return CoreStatus::Error;
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+CoreStatus CoreGame::encode(const std::string_view guess) noexcept
+{
+	// A letter takes at least one byte, so a guess that fits in the capacity of the word never makes it allocate.
+	if (guess.size() > word.capacity())
+		return CoreStatus::InvalidArgument;
+
+	if (!solver.guesses.alphabet().encode(guess, word))
+		return CoreStatus::InvalidWord;
+
+	return (word.size() == solver.length) ? CoreStatus::Ok : CoreStatus::InvalidArgument;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+CoreStatus CoreGame::apply() noexcept
+{
+	// Only words of the Dictionary can be guessed.
+	if (!solver.words.contains(word))
+		return CoreStatus::InvalidWord;
+
+	const LetterSet invalidated{ ai.invalidated };
+	previous = ai.dict;
+
+	ai.updateDictionary(feedback);
+
+	// Results that no word matches are a mistake by the caller, so the game is put back the way it was.
+	if (ai.dict.empty())
+	{
+		ai.dict = previous;
+		ai.invalidated = invalidated;
+		return CoreStatus::NoCandidates;
+	}
+
+	++turns;
+	return CoreStatus::Ok;
+}
+
+// ================================================================================================================================ //
+
+/*
+	A guess and an answer, stored in codes of their own: the first letter that they use is 'a', the next is 'b', and so on.
+	Their Pattern only depends on which of their letters are the same, so it can be found without the Alphabet of a Dictionary.
+*/
+struct WordPair
+{
+	char guess[max_pattern_length];
+	char answer[max_pattern_length];
+	std::size_t length;
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Stores the guess and the answer (UTF-8) in the pair. Returns InvalidWord if either of them has a character that is not a letter,
+// or InvalidArgument if they do not have the same number of letters (or have more than max_pattern_length).
+static CoreStatus encode_pair(const std::string_view guess, const std::string_view answer, WordPair& pair) noexcept
+{
+	char32_t letters[2 * max_pattern_length]{};
+	std::size_t letter_count{};
+
+	const auto encode = [&](std::string_view text, char* const codes) -> std::size_t
+	{
+		std::size_t size{};
+		while (!text.empty())
+		{
+			const char32_t letter{ read_letter(text) };
+			if (letter == 0)
+				return 0;
+
+			if (size == max_pattern_length)
+				return max_pattern_length + 1;
+
+			const auto found{ std::find(letters, letters + letter_count, letter) };
+			if (found == letters + letter_count)
+				letters[letter_count++] = letter;
+
+			codes[size++] = letter_code(std::size_t(found - letters));
+		}
+		return size;
+	};
+
+	const std::size_t guess_size{ encode(guess, pair.guess) };
+	const std::size_t answer_size{ encode(answer, pair.answer) };
+
+	if ((guess_size == 0 && !guess.empty()) || (answer_size == 0 && !answer.empty()))
+		return CoreStatus::InvalidWord;
+
+	if (guess_size != answer_size || guess_size > max_pattern_length)
+		return CoreStatus::InvalidArgument;
+
+	pair.length = guess_size;
+	return CoreStatus::Ok;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+CoreStatus write_feedback(const std::string_view guess, const std::string_view answer, char* const results, const std::size_t capacity) noexcept
+{
+	constexpr std::string_view chars{ "X-O" };
+
+	if (!results)
+		return CoreStatus::InvalidArgument;
+
+	WordPair pair{};
+	if (const CoreStatus status{ encode_pair(guess, answer, pair) }; status != CoreStatus::Ok)
+		return status;
+
+	if (capacity <= pair.length)
+		return CoreStatus::BufferTooSmall;
+
+	Pattern pattern{ make_pattern(std::string_view{ pair.guess, pair.length }, std::string_view{ pair.answer, pair.length }) };
+	for (std::size_t i{}; i < pair.length; ++i, pattern /= 3)
+	{
+		results[i] = chars[pattern % 3];
+	}
+	results[pair.length] = '\0';
+
+	return CoreStatus::Ok;
+}
+
+// ================================================================================================================================ //
+// C Interface
+// ================================================================================================================================ //
+
+// The opaque types of the C interface are the C++ classes (so that they are built in place, without copying the Dictionary).
+struct wordle_solver : CoreSolver
+{
+	using CoreSolver::CoreSolver;
+};
+
+struct wordle_game : CoreGame
+{
+	using CoreGame::CoreGame;
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+static_assert(int(CoreStatus::Ok) == WORDLE_OK && int(CoreStatus::InvalidArgument) == WORDLE_INVALID_ARGUMENT);
+static_assert(int(CoreStatus::InvalidWord) == WORDLE_INVALID_WORD && int(CoreStatus::InvalidResults) == WORDLE_INVALID_RESULTS);
+static_assert(int(CoreStatus::NoCandidates) == WORDLE_NO_CANDIDATES && int(CoreStatus::BufferTooSmall) == WORDLE_BUFFER_TOO_SMALL);
+static_assert(int(CoreStatus::OutOfMemory) == WORDLE_OUT_OF_MEMORY && int(CoreStatus::Error) == WORDLE_ERROR);
+
+// Converts the status of the C++ interface to the status of the C interface.
+static wordle_status to_status(const CoreStatus status) noexcept
+{
+	return wordle_status(status);
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Calls the function, and converts any exception that it throws into a status (exceptions must not cross the C interface).
+template<class Function>
+static wordle_status guarded(Function&& function) noexcept
+{
+	try
+	{
+		return function();
+	}
+	catch (const std::bad_alloc&)
+	{
+		return WORDLE_OUT_OF_MEMORY;
+	}
+	catch (...)
+	{
+		return WORDLE_ERROR;
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+extern "C"
+{
+
+const char* wordle_status_message(const wordle_status status)
+{
+	return status_message(CoreStatus(status));
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_solver_create(const char* const words, const size_t size, const size_t word_length, wordle_solver** const solver)
+{
+	if (!words || !solver || word_length == any_length)
+		return WORDLE_INVALID_ARGUMENT;
+
+	return guarded([&]() {
+		*solver = new wordle_solver(parse_dictionary(std::string_view{ words, size }, word_length, true), word_length);
+		return WORDLE_OK;
+	});
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_solver_load(const char* const filename, const size_t word_length, wordle_solver** const solver)
+{
+	if (!filename || !solver || word_length == any_length)
+		return WORDLE_INVALID_ARGUMENT;
+
+	return guarded([&]() {
+		*solver = new wordle_solver(load_dictionary(filename, word_length, true), word_length);
+		return WORDLE_OK;
+	});
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void wordle_solver_destroy(wordle_solver* const solver)
+{
+	delete solver;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+size_t wordle_solver_word_count(const wordle_solver* const solver)
+{
+	return solver ? solver->dictionary().size() : 0;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+size_t wordle_solver_word_length(const wordle_solver* const solver)
+{
+	return solver ? solver->word_length() : 0;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_game_create(const wordle_solver* const solver, wordle_game** const game)
+{
+	if (!solver || !game)
+		return WORDLE_INVALID_ARGUMENT;
+
+	return guarded([&]() {
+		*game = new wordle_game(*solver);
+		return WORDLE_OK;
+	});
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void wordle_game_destroy(wordle_game* const game)
+{
+	delete game;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void wordle_game_reset(wordle_game* const game)
+{
+	if (game)
+		game->reset();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_game_update(wordle_game* const game, const char* const guess, const char* const results, const size_t length)
+{
+	if (!game || !guess || !results)
+		return WORDLE_INVALID_ARGUMENT;
+
+	return to_status(game->update(std::string_view{ guess, utf8_size(guess, length) }, std::string_view{ results, length }));
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_game_update_pattern(wordle_game* const game, const char* const guess, const size_t length, const uint32_t pattern)
+{
+	if (!game || !guess)
+		return WORDLE_INVALID_ARGUMENT;
+
+	return to_status(game->update(std::string_view{ guess, utf8_size(guess, length) }, Pattern(pattern)));
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_game_guess(wordle_game* const game, char* const guess, const size_t capacity)
+{
+	if (!game || !guess)
+		return WORDLE_INVALID_ARGUMENT;
+
+	std::string_view word{};
+	if (const CoreStatus status{ game->guess(word) }; status != CoreStatus::Ok)
+		return to_status(status);
+
+	if (capacity <= word.size())
+		return WORDLE_BUFFER_TOO_SMALL;
+
+	std::copy(word.begin(), word.end(), guess);
+	guess[word.size()] = '\0';
+	return WORDLE_OK;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+size_t wordle_game_candidates(const wordle_game* const game)
+{
+	return game ? game->candidates() : 0;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+size_t wordle_game_turn(const wordle_game* const game)
+{
+	return game ? game->turn() : 0;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_pattern(const char* const guess, const char* const answer, const size_t length, uint32_t* const pattern)
+{
+	if (!guess || !answer || !pattern || length > max_pattern_length)
+		return WORDLE_INVALID_ARGUMENT;
+
+	WordPair pair{};
+	const CoreStatus status{ encode_pair(std::string_view{ guess, utf8_size(guess, length) }, std::string_view{ answer, utf8_size(answer, length) }, pair) };
+	if (status != CoreStatus::Ok)
+		return to_status(status);
+
+	*pattern = make_pattern(std::string_view{ pair.guess, pair.length }, std::string_view{ pair.answer, pair.length });
+	return WORDLE_OK;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+wordle_status wordle_feedback(const char* const guess, const char* const answer, const size_t length, char* const results, const size_t capacity)
+{
+	if (!guess || !answer)
+		return WORDLE_INVALID_ARGUMENT;
+
+	if (length > max_pattern_length)
+		return WORDLE_INVALID_ARGUMENT;
+
+	return to_status(write_feedback(std::string_view{ guess, utf8_size(guess, length) }, std::string_view{ answer, utf8_size(answer, length) }, results, capacity));
+}
+
+}
+
+// ================================================================================================================================ //
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <string_view>
+
+#include "Dictionary.h"
+#include "WordleSim.h"
+#include "WordleAI.h"
+#include "LetterIndex.h"
+#include "WordSet.h"
+
+// ================================================================================================================================ //
+
+/*
+	The Wordle Solver Core: the Dictionary, Sim and AI code, without any console I/O.
+	It can be built into a library on its own (everything but main.cpp and the commands), and it also has a C interface (wordle_core.h).
+
+	Only the setup (building a CoreSolver or a CoreGame) allocates memory or throws.
+	Every call that plays a game takes string_views, writes into the caller's buffers, and returns a CoreStatus instead of throwing.
+	Words are given and returned as UTF-8 (in the letters of the Dictionary's Alphabet, in any case).
+*/
+
+// The result of a call to the Core (the same values as wordle_status).
+enum class CoreStatus : int
+{
+	Ok,
+	InvalidArgument, // A length did not match the length of the words (or a buffer is missing).
+	InvalidWord,     // The guess is not in the Dictionary.
+	InvalidResults,  // The results are not made up of 'X', '-' and 'O' (or the Pattern is out of range).
+	NoCandidates,    // No word matches the results of every guess so far (the game is left as it was).
+	BufferTooSmall,  // The output buffer cannot hold the word and its null terminator.
+	OutOfMemory,     // Memory could not be allocated.
+	Error,           // Any other error.
+};
+
+// Returns a description of the status.
+const char* status_message(const CoreStatus status) noexcept;
+
+// ================================================================================================================================ //
+
+/*
+	The words (of a single length) that games are played with, and their indices.
+	It is read-only once it is built, so a single CoreSolver can be shared by every game on every thread.
+*/
+class CoreSolver
+{
+	// Allows games to play with the indices.
+	friend class CoreGame;
+
+private: // Variables
+
+	// The valid guesses (which are also the possible answers).
+	const Dictionary guesses;
+	const DictionaryView view;
+
+	// Indices of the guesses.
+	const LetterIndex index;
+	const WordSet words;
+
+	// The length of every word.
+	const std::size_t length;
+
+public: // Functions
+
+	// Builds the solver from the words of the given length in the Dictionary (throws if there are none).
+	CoreSolver(Dictionary&& dict, const std::size_t word_length);
+
+	// Returns the guesses.
+	inline const Dictionary& dictionary() const noexcept
+	{
+		return guesses;
+	}
+
+	// Returns the length of every word.
+	inline std::size_t word_length() const noexcept
+	{
+		return length;
+	}
+
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+/*
+	The state of a single game played with the words of a CoreSolver (which must outlive it).
+	Updating the game and making a guess do not allocate, so a game can be reset and played again as many times as needed.
+*/
+class CoreGame
+{
+private: // Variables
+
+	const CoreSolver& solver;
+
+	// The AI, and the candidates that every game starts with (resetting copies them back into the AI's storage).
+	WordleAI ai;
+	const CandidateSet start;
+
+	// The Results of the latest guess, and the candidates before it (kept so that updates do not allocate them).
+	Results feedback;
+	CandidateSet previous;
+
+	// The latest guess given to update() in the codes of the Alphabet, and the latest guess made as UTF-8 (both are preallocated).
+	std::string word;
+	std::string text;
+
+	// The number of guesses made so far.
+	std::size_t turns;
+
+public: // Functions
+
+	// Starts a game with the words of the solver.
+	CoreGame(const CoreSolver& solver);
+
+	// Starts the game over.
+	void reset() noexcept;
+
+	// Removes the candidates that do not match the Results of the guess (UTF-8), written in the format of Results::str().
+	CoreStatus update(const std::string_view guess, const std::string_view results) noexcept;
+
+	// Removes the candidates that do not match the Pattern of the guess (UTF-8).
+	CoreStatus update(const std::string_view guess, const Pattern pattern) noexcept;
+
+	// Sets guess to the AI's next guess as UTF-8 (a view of the game's own buffer, which stays valid until the next call).
+	CoreStatus guess(std::string_view& guess) noexcept;
+
+	// Returns the number of words that could still be the answer.
+	inline std::size_t candidates() const noexcept
+	{
+		return ai.dict.size();
+	}
+
+	// Returns the number of guesses made so far.
+	inline std::size_t turn() const noexcept
+	{
+		return turns;
+	}
+
+private: // Helper Functions
+
+	// Stores the guess in the codes of the Alphabet (in word), and checks that it has as many letters as the words.
+	CoreStatus encode(const std::string_view guess) noexcept;
+
+	// Checks the guess (stored in word), and applies the Results that have been written to feedback.
+	CoreStatus apply() noexcept;
+
+};
+
+// ================================================================================================================================ //
+
+// Writes the Results of the guess against the answer (both UTF-8) into the buffer in the format of Results::str() (followed by a null terminator).
+CoreStatus write_feedback(const std::string_view guess, const std::string_view answer, char* const results, const std::size_t capacity) noexcept;
+
+// ================================================================================================================================ //
@@ -45,6 +45,28 @@ std::string Results::str() const
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
+// Constructs the Results of a guess from their Textual Representation (the format returned by str()).
+Results Results::parse(const std::string_view guess, const std::string_view text)
+{
+	constexpr std::string_view chars{ "X-O" };
+
+	if (guess.size() != text.size())
+		throw std::runtime_error("Results size does not equal Guess size.");
+
+	Results feedback{ guess.size() };
+	for (std::size_t i{}; i < guess.size(); ++i)
+	{
+		const auto result_i{ chars.find(static_cast<char>(std::toupper(text[i]))) };
+		if (result_i == std::string_view::npos || letter_index(guess[i]) >= max_letters)
+			throw std::runtime_error("Invalid character found in Results.");
+
+		feedback[i] = Feedback{ guess[i], Result(result_i) };
+	}
+	return feedback;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
 // Returns a reference to the Result at index i.
 Feedback& Results::at(const std::size_t i)
 {
@@ -96,15 +118,24 @@ Results::iterator Results::end() const noexcept
 // ================================================================================================================================ //
 
 // Constructor
-WordleSim::WordleSim(const std::string& word)
+WordleSim::WordleSim(const std::string_view word)
 	:
 	word{ word }, try_count{}
 {}
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
+// Returns the code of the letter, folding an uppercase English letter to its lowercase code.
+// Only 'A' to 'Z' are folded: every other letter of an Alphabet is stored as a code past 'z', which std::tolower() could change.
+static char fold_case(const char chr) noexcept
+{
+	return (chr >= 'A' && chr <= 'Z') ? static_cast<char>(chr - 'A' + 'a') : chr;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
 // Takes a String as a Guess and returns a Results representing how accurate the guess was.
-Results WordleSim::make_guess(const std::string& guess)
+Results WordleSim::make_guess(const std::string_view guess)
 {
 	if (guess.size() != word.size())
 		throw std::runtime_error("Guess size does not equal Word size.");
@@ -115,14 +146,14 @@ Results WordleSim::make_guess(const std::string& guess)
 	// For all Letters in the Hidden Word.
 	for (std::size_t wi{}; wi < word.size(); ++wi)
 	{
-		// Assign letter from guess to feedback.
-		feedback[wi].letter = guess[wi];
+		// Assign letter from guess to feedback (in the code of the letter, so it can be given straight to the AI).
+		feedback[wi].letter = fold_case(guess[wi]);
 		
-		const auto current_letter{ std::tolower(word[wi]) };
+		const char current_letter{ fold_case(word[wi]) };
 
 		// Number of occurrences of the current Letter.
 		// Counts down as Result values are assigned later.
-		auto count{ std::count(word.begin(), word.end(), current_letter) };
+		auto count{ std::count_if(word.begin(), word.end(), [&](const char chr) { return fold_case(chr) == current_letter; }) };
 
 		// Lambda Function that assigns results based on whether or not letters are in the right position.
 		const auto assign = [&](const bool should_match, const Result result)
@@ -133,8 +164,8 @@ Results WordleSim::make_guess(const std::string& guess)
 				// All non-Invalid Results have been assigned, all else must be Invalid.
 				if (count == 0) break;
 
-				const auto wchar{ std::tolower(word[gi]) };
-				const auto gchar{ std::tolower(guess[gi]) };
+				const char wchar{ fold_case(word[gi]) };
+				const char gchar{ fold_case(guess[gi]) };
 				if (gchar != current_letter) continue;
 				
 				if ((gchar == wchar) == should_match)
@@ -172,9 +203,45 @@ std::size_t WordleSim::tries() const noexcept
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
-const std::string& WordleSim::answer() const noexcept
+std::string_view WordleSim::answer() const noexcept
 {
 	return word;
 }
 
 // ================================================================================================================================ //
+
+Pattern make_pattern(const std::string_view guess, const std::string_view answer) noexcept
+{
+	// Occurrences of each letter in the answer that were not matched by a Correct letter.
+	// Only the entries of the letters in the two words are cleared, so the cost does not grow with the size of the alphabet.
+	unsigned char unmatched[max_letters];
+	for (std::size_t i{}; i < answer.size(); ++i)
+	{
+		unmatched[letter_index(guess[i])] = 0;
+		unmatched[letter_index(answer[i])] = 0;
+	}
+
+	for (std::size_t i{}; i < answer.size(); ++i)
+	{
+		if (guess[i] != answer[i])
+			++unmatched[letter_index(answer[i])];
+	}
+
+	Pattern pattern{};
+	Pattern digit{ 1 };
+	for (std::size_t i{}; i < guess.size(); ++i, digit *= 3)
+	{
+		if (guess[i] == answer[i])
+		{
+			pattern += digit * Pattern(Result::Correct);
+		}
+		else if (unsigned char& count{ unmatched[letter_index(guess[i])] }; count > 0)
+		{
+			pattern += digit * Pattern(Result::Exists);
+			--count;
+		}
+	}
+	return pattern;
+}
+
+// ================================================================================================================================ //
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 #include <vector>
 #include <string>
@@ -59,6 +60,9 @@ public: // Functions
 	// Returns a Textual Representation of the results.
 	std::string str() const;
 
+	// Constructs the Results of a guess from their Textual Representation (the format returned by str()).
+	static Results parse(const std::string_view guess, const std::string_view text);
+
 	
 	// Returns a reference to the Result at index i.
 	Feedback& at(const std::size_t i);
@@ -90,7 +94,7 @@ class WordleSim
 private: // Variables
 
 	// The Word that is to be guessed.
-	const std::string& word;
+	std::string_view word;
 
 	// The number of guesses made so far.
 	std::size_t try_count;
@@ -98,10 +102,11 @@ private: // Variables
 public: // Functions
 
 	// Constructor
-	WordleSim(const std::string& word);
+	WordleSim(const std::string_view word);
 
 	// Takes a String as a Guess and returns a Results representing how accurate the guess was.
-	Results make_guess(const std::string& guess);
+	// English letters are compared ignoring case (the letters of the Results are always lowercase).
+	Results make_guess(const std::string_view guess);
 
 	// Returns the length of the word to be guessed.
 	std::size_t word_length() const noexcept;
@@ -110,8 +115,38 @@ public: // Functions
 	std::size_t tries() const noexcept;
 
 	// Returns the correct answer.
-	const std::string& answer() const noexcept;
+	std::string_view answer() const noexcept;
 
 };
 
 // ================================================================================================================================ //
+
+/*
+	Numerical encoding of the Results of a guess.
+	Each letter's Result is one base-3 digit (the first letter is the least significant digit).
+*/
+using Pattern = std::uint32_t;
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the number of distinct Patterns for words of the given length (3^length).
+constexpr Pattern pattern_count(const std::size_t word_length) noexcept
+{
+	Pattern count{ 1 };
+	for (std::size_t i{}; i < word_length; ++i)
+		count *= 3;
+	return count;
+}
+
+// Returns the Pattern of a guess where every letter is Correct.
+constexpr Pattern winning_pattern(const std::size_t word_length) noexcept
+{
+	return pattern_count(word_length) - 1;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the Pattern that WordleSim::make_guess() would give for the guess (both words must be in the codes of one Alphabet, and the same length).
+Pattern make_pattern(const std::string_view guess, const std::string_view answer) noexcept;
+
+// ================================================================================================================================ //
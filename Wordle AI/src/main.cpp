@@ -13,12 +13,16 @@
 /*
 	The main function where the program starts.
 	This Program tests the Wordle AI by letting the user enter commands for it in the console.
+	A command can also be given on the command line (for scripts that check its exit code).
 */
-int main()
+int main(const int argc, char* argv[])
 {
 	// Attempt to launch the Wordle AI in an interactive console.
 	try
 	{
+		if (argc > 1)
+			return run_command_line(argc, argv);
+
 		prompt_user();
 		return 0;
 	}
@@ -1,9 +1,28 @@
 #include "testing.h"
+#include "Solver.h"
+#include "Random.h"
+#include "Server.h"
+#include "WordSet.h"
+#include "Dawg.h"
+#include "Profiler.h"
+#include "Comparison.h"
+#include "Embedded.h"
+#include "Verify.h"
+#include "Progress.h"
+#include "Placement.h"
+#include "Memory.h"
 
 #include <iomanip>
+#include <iterator>
 #include <fstream>
+#include <filesystem>
+#include <map>
 #include <sstream>
 #include <chrono>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
 
 // This Macro can be set externally with compilation flags.
 #ifndef NO_MULTITHREADING
@@ -18,8 +37,10 @@ void play_ai(const DictType type, const std::size_t suggested_length, const std:
 	const Dictionary dict_g{ load_guesses(type, word.size()) };
 	const DictionaryView dict_v{ dict_g };
 
+	const LetterIndex index{ dict_g };
+
 	WordleSim sim{ pick_word(dict_g, word) };
-	WordleAI ai{ dict_v, sim.word_length() };
+	WordleAI ai{ dict_v, sim.word_length(), &index };
 
 	std::cout << "\n==== WORDLE AI ====\n";
 	std::cout << "\nWord Length is " << sim.word_length() << '\n';
@@ -31,7 +52,7 @@ void play_ai(const DictType type, const std::size_t suggested_length, const std:
 		std::cout << "\n-- Turn " << (sim.tries() + 1) << " --\n";
 		std::cout << "AI Dictionary Size: " << ai.dict.size() << "\n";
 
-		const std::string& guess{ ai.makeGuess(sim.tries()) };
+		const std::string_view guess{ ai.makeGuess(sim.tries()) };
 		std::cout << "  Guess: " << guess << '\n';
 
 		feedback = sim.make_guess(guess);
@@ -52,40 +73,137 @@ void play_ai(const DictType type, const std::size_t suggested_length, const std:
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
-void test_ai(const DictType type, const std::size_t word_length)
+void assist_ai(const DictType type, const std::size_t word_length, const std::size_t count)
 {
-	const Dictionary dict_a{ load_answers(type, word_length) };
 	const Dictionary dict_g{ load_guesses(type, word_length) };
 	const DictionaryView dict_v{ dict_g };
 
-	std::cout << "\n=========================== WORDLE AI TEST ===========================\n\n";
+	const LetterIndex index{ dict_g };
+	const WordSet words{ dict_g };
 
-	std::cout << "Testing AI on all words in '" << dictionary_name(type, word_length) << "'...\n";
+	// The state of the AI after each guess (undoing a guess goes back to the previous state).
+	std::vector<WordleAI> states{ WordleAI{ dict_v, word_length, &index } };
+	double elapsed{};
 
-	const auto start_time{ std::chrono::steady_clock::now() };
+	std::cout << "\n==== WORDLE ASSISTANT ====\n";
+	std::cout << "\nEnter each guess followed by its results (X = Invalid, - = Exists, O = Correct).\n";
+	std::cout << "Enter \"undo\" to take back the last guess, \"new\" to start a new game, or \"done\" to stop.\n";
 
-	std::vector<unsigned char> games(dict_a.size());
-
-#ifndef NO_MULTITHREADING
-	std::transform(std::execution::par_unseq, dict_a.begin(), dict_a.end(), games.begin(), [&](const std::string& word)
-#else
-	std::transform(dict_a.begin(), dict_a.end(), games.begin(), [&](const std::string& word)
-#endif
+	while (true)
 	{
-		WordleSim sim{ word };
-		WordleAI ai{ dict_v, sim.word_length() };
+		const WordleAI& ai{ states.back() };
+		const std::size_t turn{ states.size() - 1 };
 
-		Results feedback{ sim.word_length() };
-		while (!feedback.is_won())
+		const auto start_time{ std::chrono::steady_clock::now() };
+		const std::vector<Suggestion> suggestions{ ai.suggestGuesses(turn, count) };
+		elapsed += std::chrono::duration<double, std::milli>{ std::chrono::steady_clock::now() - start_time }.count();
+
+		std::cout << "\n-- Turn " << (turn + 1) << " --\n";
+		std::cout << "Remaining Candidates: " << ai.dict.size() << "\n";
+		std::cout << "Suggestions (* = could be the answer):\n";
+
+		for (std::size_t i{}; i < suggestions.size(); ++i)
 		{
-			const std::string& guess{ ai.makeGuess(sim.tries()) };
-			feedback = sim.make_guess(guess);
-			ai.updateDictionary(feedback);
+			std::string word{ suggestions[i].word };
+			make_uppercase(word);
+
+			std::cout << std::setw(5) << (i + 1) << ". " << word << (suggestions[i].candidate ? " *" : "  ") << "  (score " << suggestions[i].score << ")\n";
 		}
-		
-		return static_cast<unsigned char>(sim.tries());
-	});
+		std::cout << "(Took " << elapsed << " ms.)\n";
+
+		// Loop until valid input.
+		while (true)
+		{
+			std::cout << "\nPlease enter a Guess and its Results: ";
+			std::string line{};
+			std::getline(std::cin, line);
+
+			if (!std::cin.good())
+				throw std::runtime_error("Standard Input stream failure.");
+
+			make_lowercase(line);
+			std::istringstream stream{ line };
+			std::string guess{};
+			std::string text{};
+			stream >> guess >> text;
+
+			if (guess == "done" && text.empty())
+			{
+				std::cout << '\n';
+				return;
+			}
+			if (guess == "new" && text.empty())
+			{
+				while (states.size() > 1)
+					states.pop_back();
+				elapsed = 0;
+				break;
+			}
+			if (guess == "undo" && text.empty())
+			{
+				if (states.size() == 1)
+				{
+					std::cout << "\nERROR! No guesses have been entered yet.\n";
+					continue;
+				}
+				states.pop_back();
+				elapsed = 0;
+				break;
+			}
+
+			if (text.empty() || (stream >> line))
+			{
+				std::cout << "\nERROR! A guess and its results must be entered.\n";
+				continue;
+			}
+			if (guess.size() != word_length || text.size() != word_length)
+			{
+				std::cout << "\nERROR! The guess and its results must be " << word_length << " letters.\n";
+				continue;
+			}
+			if (!words.contains(guess))
+			{
+				std::cout << "\nERROR! \"" << guess << "\" could not be found in dictionary.\n";
+				continue;
+			}
+			if (!std::all_of(text.begin(), text.end(), [](const char chr) { return chr == 'x' || chr == '-' || chr == 'o'; }))
+			{
+				std::cout << "\nERROR! Results must only be made up of X, - and O.\n";
+				continue;
+			}
+
+			const Results feedback{ Results::parse(guess, text) };
+			if (feedback.is_won())
+			{
+				std::cout << "\n==== SOLVED IN " << (turn + 1) << " TURN(S)! ====\n";
+				while (states.size() > 1)
+					states.pop_back();
+				elapsed = 0;
+				break;
+			}
+
+			const auto update_time{ std::chrono::steady_clock::now() };
+			WordleAI next{ ai };
+			next.updateDictionary(feedback);
+			elapsed = std::chrono::duration<double, std::milli>{ std::chrono::steady_clock::now() - update_time }.count();
+
+			if (next.dict.empty())
+			{
+				std::cout << "\nERROR! No words match the given results (check them for typos).\n";
+				continue;
+			}
+
+			states.push_back(std::move(next));
+			break;
+		}
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
 
+// Totals the results of a set of games.
+static Stats tally(const std::vector<unsigned char>& games)
+{
 	Stats stats{};
 	for (const auto tries : games)
 	{
@@ -96,11 +214,14 @@ void test_ai(const DictType type, const std::size_t word_length)
 		else
 			stats.add_loss(tries);
 	}
+	return stats;
+}
 
-	const auto end_time{ std::chrono::steady_clock::now() };
-	const std::chrono::duration<double> elapsed_time{ end_time - start_time };
-
+// -------------------------------------------------------------------------------------------------------------------------------- //
 
+// Formats the statistics of a test run (notes are the lines that describe how the run went, such as its duration).
+static std::string format_stats(const std::string& name, const Stats& stats, const std::string& notes, const bool intervals)
+{
 	std::ostringstream o_games{};
 	std::ostringstream w_games{}; 
 	std::ostringstream l_games{};
@@ -120,63 +241,893 @@ void test_ai(const DictType type, const std::size_t word_length)
 	w_turns << '[' << stats.average_turns_wins() << " Turn Avg.]";
 	l_turns << '[' << stats.average_turns_losses() << " Turn Avg.]";
 
-	const std::string og_str{ o_games.str() };
-	const std::string or_str{ "" };
-	const std::string ot_str{ o_turns.str() };
-	
-	const std::string wg_str{ w_games.str() };
-	const std::string wr_str{ w_ratio.str() };
-	const std::string wt_str{ w_turns.str() };
-	
-	const std::string lg_str{ l_games.str() };
-	const std::string lr_str{ l_ratio.str() };
-	const std::string lt_str{ l_turns.str() };
+	const std::string og_str{ o_games.str() };
+	const std::string or_str{ "" };
+	const std::string ot_str{ o_turns.str() };
+	
+	const std::string wg_str{ w_games.str() };
+	const std::string wr_str{ w_ratio.str() };
+	const std::string wt_str{ w_turns.str() };
+	
+	const std::string lg_str{ l_games.str() };
+	const std::string lr_str{ l_ratio.str() };
+	const std::string lt_str{ l_turns.str() };
+
+	const std::size_t g_size{ std::max({ og_str.size(), wg_str.size(), lg_str.size() }) };
+	const std::size_t r_size{ std::max({ or_str.size(), wr_str.size(), lr_str.size() }) };
+	const std::size_t t_size{ std::max({ ot_str.size(), wt_str.size(), lt_str.size() }) };
+
+	std::ostringstream statstream{};
+	statstream
+		<< "========================== WORDLE AI  STATS ==========================" << '\n'
+		<< '\n'
+		<< name << '\n'
+		<< notes
+		<< '\n'
+		<< "Overall:   " << std::setw(g_size) << og_str << "   " << std::setw(r_size) << or_str << "   " << std::setw(t_size) << ot_str << '\n'
+		<< "   Wins:   " << std::setw(g_size) << wg_str << "   " << std::setw(r_size) << wr_str << "   " << std::setw(t_size) << wt_str << '\n'
+		<< " Losses:   " << std::setw(g_size) << lg_str << "   " << std::setw(r_size) << lr_str << "   " << std::setw(t_size) << lt_str << '\n';
+
+	if (intervals)
+	{
+		const auto [win_low, win_high] { stats.win_ratio_interval() };
+		statstream
+			<< '\n'
+			<< "95% Confidence Intervals:" << '\n'
+			<< "   Win Ratio:   " << win_low << "% - " << win_high << '%' << '\n'
+			<< "   Turn Avg.:   " << stats.average_turns() << " +/- " << stats.average_turns_margin() << '\n';
+	}
+
+	statstream
+		<< '\n'
+		<< "======================================================================" << '\n';
+
+	return statstream.str();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Writes the statistics and the result of every game to the given file (and the machine-readable results to a ".tsv" file next to it).
+static void write_results(const std::string& filename, const std::string& stats, const std::string& name, const double seconds,
+	const Dictionary& words, const std::vector<unsigned char>& games)
+{
+	std::ofstream file{ filename };
+	
+	if (!file)
+	{
+		throw std::runtime_error("Unable to open output file.");
+	}
+	else
+	{
+		std::cout << "Writing results to '" << filename << "'...\n";
+		
+		file << stats << '\n';
+
+		file << "\n==== GAME RESULTS ====\n\n";
+
+		for (std::size_t i{}; i < words.size(); ++i)
+		{
+			const std::string_view word{ words[i] };
+			const std::size_t tries{ static_cast<std::size_t>(games[i]) };
+			const bool won{ tries <= 6 };
+		
+			file << word << ": " << tries << " turns  [" << (won ? "WIN" : "LOSE") << "]\n";
+		}
+
+		file << "\n======================\n";
+
+		write_run(filename.substr(0, filename.rfind('.')) + ".tsv", name, seconds, words, games);
+		
+		std::cout << "Done!\n";
+	}
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+/*
+	The data that every game of a test reads and never changes: the answers, the guesses and the index of the guesses.
+	With a placement policy it is built in a ReadOnlyArena, and there may be a copy of it on every NUMA node that plays games.
+*/
+struct SharedData
+{
+	// The memory that the data is placed in (or none for the default resource).
+	std::unique_ptr<ReadOnlyArena> arena;
+
+	Dictionary answers;
+	Dictionary guesses;
+	DictionaryView view;
+	LetterIndex index;
+
+	// Copies the dictionaries into the arena, and builds the view and the index of the guesses there.
+	SharedData(std::unique_ptr<ReadOnlyArena> memory, const Dictionary& answer_words, const Dictionary& guess_words)
+		:
+		arena{ std::move(memory) }, answers{ answer_words, resource() }, guesses{ guess_words, resource() }, view{ guesses, resource() }, index{ guesses, resource() }
+	{
+		require_same_alphabet(answers, guesses);
+	}
+
+	SharedData(const SharedData&) = delete;
+	SharedData& operator=(const SharedData&) = delete;
+
+	// Returns the resource that the data is placed in.
+	std::pmr::memory_resource* resource() const noexcept
+	{
+		return arena ? arena->resource() : std::pmr::get_default_resource();
+	}
+
+	// Returns the number of bytes that the data takes up.
+	std::size_t memory_usage() const noexcept
+	{
+		return answers.memory_usage() + guesses.memory_usage() + view.memory_usage() + index.memory_usage();
+	}
+};
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the CPUs that the games are played on, by node (or none, to play them with the standard parallel algorithms).
+static std::vector<std::vector<int>> pick_workers(const PlacementOptions& placement)
+{
+	if (placement.threads == 0 && !placement.replicate)
+		return {};
+
+	return pick_cpus(placement.threads != 0 ? placement.threads : cpu_count());
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Builds the data that the games read, placed as the options say: [Node] -> The copy for the node's workers if it is replicated
+// (nodes without workers get none), or else a single copy.
+static std::vector<std::unique_ptr<SharedData>> place_data(const Dictionary& answers, const Dictionary& guesses, const PlacementOptions& placement,
+	const std::vector<std::vector<int>>& cpus)
+{
+	std::vector<std::unique_ptr<SharedData>> replicas{};
+
+	if (placement.replicate && cpus.size() > 1)
+	{
+		const std::vector<NumaNode>& nodes{ numa_nodes() };
+		for (std::size_t node{}; node < cpus.size(); ++node)
+		{
+			if (cpus[node].empty())
+				replicas.emplace_back();
+			else
+				replicas.push_back(std::make_unique<SharedData>(std::make_unique<ReadOnlyArena>(placement.pages, nodes[node].id), answers, guesses));
+		}
+	}
+	else
+	{
+		std::unique_ptr<ReadOnlyArena> arena{};
+		if (placement.pages != PageMode::Default)
+			arena = std::make_unique<ReadOnlyArena>(placement.pages);
+
+		replicas.push_back(std::make_unique<SharedData>(std::move(arena), answers, guesses));
+	}
+
+	return replicas;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the number of bytes that the dictionaries of a run take up (the given dictionaries, and every copy of the shared data).
+static std::size_t dictionary_usage(const std::vector<const Dictionary*>& dictionaries, const std::vector<std::unique_ptr<SharedData>>& replicas)
+{
+	std::size_t bytes{};
+	for (const Dictionary* const dict : dictionaries)
+		bytes += dict->memory_usage();
+
+	for (const std::unique_ptr<SharedData>& data : replicas)
+		bytes += data ? data->memory_usage() : 0;
+
+	return bytes;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Describes the peak memory of every subsystem since the peaks were last reset, and the peak RSS of the process (for the notes of a run).
+static std::string describe_memory(const MemoryLedger::Report& report)
+{
+	std::ostringstream text{};
+	text << format_bytes(report.peaks[std::size_t(Subsystem::Dictionaries)]) << " dictionaries, "
+		<< format_bytes(report.peaks[std::size_t(Subsystem::Games)]) << " game state, "
+		<< format_bytes(report.peaks[std::size_t(Subsystem::Caches)]) << " caches (" << format_bytes(report.peak_total) << " at once";
+
+	if (report.budget != 0)
+		text << ", of a " << format_bytes(report.budget) << " budget";
+
+	text << "), " << format_bytes(peak_rss()) << " peak RSS";
+	return text.str();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Describes how the shared data is placed, and where the games are played (for the notes of a run).
+static std::string describe_placement(const std::vector<std::unique_ptr<SharedData>>& replicas, const std::vector<std::vector<int>>& cpus)
+{
+	const SharedData& data{ *replicas[std::size_t(std::find_if(replicas.begin(), replicas.end(), [](const auto& replica) { return replica != nullptr; }) - replicas.begin())] };
+	const std::size_t copies{ std::size_t(std::count_if(replicas.begin(), replicas.end(), [](const auto& replica) { return replica != nullptr; })) };
+
+	std::size_t workers{};
+	for (const std::vector<int>& node : cpus)
+		workers += node.size();
+
+	std::ostringstream text{};
+	text << (data.arena ? page_mode_name(data.arena->backing()) : "default") << " pages";
+
+	if (copies > 1)
+		text << ", a copy on each of " << copies << " NUMA nodes";
+
+	if (workers != 0)
+		text << ", " << workers << " pinned worker" << (workers != 1 ? "s" : "");
+
+	return text.str();
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+/*
+	Plays the AI against every answer and writes the number of tries each game took to games (returns the number of guesses made).
+	Every finished game is also recorded in the progress counters, and the state of the games is charged to the MemoryLedger after every
+	turn. If cancellation is requested, the games that are still being played are abandoned (and left at 0 tries).
+
+	The games are played in lockstep, one turn at a time. Games that have had the same Feedback so far leave the AI in the same state,
+	so they are kept together in a group that only makes each guess (and each update) once, and is split by the Feedback it gets.
+	The total work is then the number of distinct states of the AI, rather than the number of games times the number of turns,
+	and every game still gets exactly the guesses that it would get if it were played on its own.
+
+	If the data is replicated, the groups that the first turn leaves are dealt to the nodes (in proportion to their workers), and each
+	group (with every group that it splits into) only reads the copy of its node from then on. If CPUs are given, each turn is played by
+	workers pinned to them (which take the groups of their own node first), or else by the standard parallel algorithms.
+*/
+static std::size_t play_lockstep(const std::vector<std::unique_ptr<SharedData>>& replicas, const std::vector<std::vector<int>>& cpus,
+	const TestOptions& options, PatternCache* const cache, std::vector<unsigned char>& games, ProgressCounters& progress)
+{
+	// Games (by index in answers) that have all had the same Feedback, the AI in the state that they leave it in, and the node that
+	// holds the data that the AI reads.
+	struct Group
+	{
+		WordleAI ai;
+		std::vector<std::uint32_t> games;
+		std::size_t node;
+	};
+
+	std::vector<Group> groups{};
+
+	// [Worker] -> The node of the worker (the groups are dealt to the workers in turn). The first turn is played on the first node.
+	std::vector<std::size_t> worker_nodes{};
+	for (std::size_t node{}; node < cpus.size(); ++node)
+		worker_nodes.insert(worker_nodes.end(), replicas.size() > 1 ? cpus[node].size() : 0, node);
+
+	const std::size_t first_node{ worker_nodes.empty() ? 0 : worker_nodes.front() };
+	const SharedData& first_data{ *replicas[first_node] };
+
+	// Games of different lengths start with different dictionaries.
+	std::map<std::size_t, std::vector<std::uint32_t>> lengths{};
+	for (std::size_t i{}; i < first_data.answers.size(); ++i)
+	{
+		lengths[first_data.answers[i].size()].push_back(static_cast<std::uint32_t>(i));
+	}
+
+	for (auto& [length, ids] : lengths)
+	{
+		Group& group{ groups.emplace_back(Group{ WordleAI{ first_data.view, length, &first_data.index }, std::move(ids), first_node }) };
+		group.ai.lookahead = options.lookahead;
+		group.ai.sampling = options.sampling;
+		group.ai.pattern_cache = cache;
+	}
+
+	// The bytes of every AI, and the games that it plays.
+	const auto memory_usage = [](const Group& group)
+	{
+		return group.ai.memory_usage() + group.games.capacity() * sizeof(std::uint32_t);
+	};
+
+	MemoryCharge state{ Subsystem::Games };
+
+	std::size_t guess_count{};
+	for (std::size_t turn{}; !groups.empty() && !cancel_requested(); ++turn)
+	{
+		guess_count += groups.size();
+
+		std::vector<std::vector<Group>> next(groups.size());
+
+		const auto advance = [&](const std::size_t g)
+		{
+			// Once cancelled, the groups that have not started this turn are dropped (so a long turn still stops quickly).
+			if (cancel_requested())
+				return;
+
+			Group& group{ groups[g] };
+			const Dictionary& words{ replicas[group.node]->answers };
+
+			std::string_view guess{};
+			{
+				const PhaseScope scope{ Phase::Guess };
+				guess = group.ai.makeGuess(turn);
+			}
+
+			std::vector<std::pair<Pattern, std::uint32_t>> results{};
+			{
+				const PhaseScope scope{ Phase::Simulate };
+				results.reserve(group.games.size());
+				for (const std::uint32_t game : group.games)
+				{
+					results.emplace_back(make_pattern(guess, words[game]), game);
+				}
+				std::sort(results.begin(), results.end());
+			}
+
+			const Pattern win{ winning_pattern(guess.size()) };
+			for (auto first{ results.begin() }; first != results.end();)
+			{
+				const auto last{ std::find_if(first, results.end(), [&](const auto& result) { return result.first != first->first; }) };
+
+				if (first->first == win)
+				{
+					games[first->second] = static_cast<unsigned char>(turn + 1);
+					progress.add_game(turn + 1);
+				}
+				else
+				{
+					Group& child{ next[g].emplace_back(Group{ group.ai, {}, group.node }) };
+					const Results feedback{ [&]
+					{
+						const PhaseScope scope{ Phase::Simulate };
+						return WordleSim{ words[first->second] }.make_guess(guess);
+					}() };
+
+					const PhaseScope scope{ Phase::Filter };
+					child.ai.updateDictionary(feedback);
+
+					for (auto it{ first }; it != last; ++it)
+						child.games.push_back(it->second);
+				}
+				first = last;
+			}
+		};
+
+		if (!cpus.empty())
+		{
+			std::vector<std::vector<std::size_t>> queues(cpus.size());
+			for (std::size_t g{}; g < groups.size(); ++g)
+				queues[groups[g].node].push_back(g);
+
+			run_pinned(cpus, queues, advance);
+		}
+		else
+		{
+			std::vector<std::size_t> indices(groups.size());
+			std::iota(indices.begin(), indices.end(), 0);
+
+#ifndef NO_MULTITHREADING
+			std::for_each(std::execution::par, indices.begin(), indices.end(), advance);
+#else
+			std::for_each(indices.begin(), indices.end(), advance);
+#endif
+		}
+
+		// The groups of this turn and the next are both held at the end of the turn (which is when the state is largest).
+		std::size_t state_bytes{};
+		for (std::size_t g{}; g < groups.size(); ++g)
+		{
+			state_bytes += memory_usage(groups[g]);
+			for (const Group& child : next[g])
+				state_bytes += memory_usage(child);
+		}
+		state.update(state_bytes);
+
+		groups.clear();
+		for (std::vector<Group>& children : next)
+		{
+			std::move(children.begin(), children.end(), std::back_inserter(groups));
+		}
+
+		// The groups are dealt once, so that a group and the groups that it splits into stay on the node that has its data cached.
+		if (turn == 0 && !worker_nodes.empty())
+		{
+			std::vector<Group> dealt{};
+			dealt.reserve(groups.size());
+
+			for (std::size_t g{}; g < groups.size(); ++g)
+			{
+				const std::size_t node{ worker_nodes[g % worker_nodes.size()] };
+				if (node == groups[g].node)
+				{
+					dealt.push_back(std::move(groups[g]));
+					continue;
+				}
+
+				const SharedData& data{ *replicas[node] };
+				dealt.push_back(Group{ WordleAI{ groups[g].ai, data.view, &data.index }, std::move(groups[g].games), node });
+			}
+
+			groups = std::move(dealt);
+		}
+	}
+
+	return guess_count;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns the name of the file that holds the partial results of a shard.
+static std::string shard_filename(const std::string& name, const std::size_t shard_index, const std::size_t shard_count)
+{
+	return std::string("./Tests/") + name + " Shard " + std::to_string(shard_index) + " of " + std::to_string(shard_count) + ".txt";
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void test_ai(const DictType type, const std::size_t word_length, const TestOptions& options)
+{
+	const Dictionary dict_all{ load_answers(type, word_length) };
+	const bool sampled{ (options.sample_size != 0) && (options.sample_size < dict_all.size()) };
+	const bool sharded{ options.shard_count != 0 };
+
+	if (sharded && (options.shard_index == 0 || options.shard_index > options.shard_count))
+		throw std::runtime_error("Invalid shard index.");
+
+	// A shard takes every Nth word, so that each shard gets a similar mix of words.
+	const auto take_shard = [&]()
+	{
+		Dictionary shard{};
+		shard.set_alphabet(dict_all.shared_alphabet());
+		for (std::size_t i{ options.shard_index - 1 }; i < dict_all.size(); i += options.shard_count)
+			shard.push_back(dict_all[i]);
+		return shard;
+	};
+
+	const Dictionary dict_a{ sampled ? sample_words(dict_all, options.sample_size) : sharded ? take_shard() : dict_all };
+	const Dictionary dict_g{ load_guesses(type, word_length) };
+
+	// The games read their own copy of the dictionaries (placed as the options say), and the index that is built with it.
+	const std::vector<std::vector<int>> cpus{ pick_workers(options.placement) };
+	const std::vector<std::unique_ptr<SharedData>> replicas{ place_data(dict_a, dict_g, options.placement, cpus) };
+
+	// The peaks of the run are measured from here (the cache is built before any game is played).
+	memory_ledger().reset_peaks();
+	const MemoryCharge dictionaries{ Subsystem::Dictionaries, dictionary_usage({ &dict_all, &dict_a, &dict_g }, replicas) };
+
+	const std::string name{ dictionary_name(type, word_length) };
+	const bool lookahead{ options.lookahead.breadth != 0 };
+	const bool sampling{ options.sampling.breadth != 0 };
+
+	std::optional<PatternCache> cache{};
+	if (options.cache_budget != 0)
+		cache.emplace(dict_g, dict_g, options.cache_budget);
+
+	std::cout << "\n=========================== WORDLE AI TEST ===========================\n\n";
+
+	if (sampled)
+		std::cout << "Testing AI on " << dict_a.size() << " random words (Seed: " << random_seed() << ") in '" << name << "'...\n";
+	else if (sharded)
+		std::cout << "Testing AI on shard " << options.shard_index << " of " << options.shard_count << " (" << dict_a.size() << " words) in '" << name << "'...\n";
+	else
+		std::cout << "Testing AI on all words in '" << name << "'...\n";
+
+	if (lookahead)
+		std::cout << "Searching ahead on the best " << options.lookahead.breadth << " guesses (up to " << options.lookahead.budget << " ms per turn)...\n";
+
+	if (sampling)
+		std::cout << "Ranking the best " << options.sampling.breadth << " exploring guesses by how they split the candidates...\n";
+
+	const auto start_time{ std::chrono::steady_clock::now() };
+
+	std::vector<unsigned char> games(dict_a.size());
+	std::size_t guess_count{};
+
+	if (options.profile)
+		start_profiling();
+
+	// Ctrl-C stops the run early (the games that finished are still written), and the progress is reported while it runs.
+	{
+		const InterruptScope interrupts{};
+		ProgressCounters progress{};
+		const ProgressReporter reporter{ progress, dict_a.size(), options.progress };
+
+		guess_count = play_lockstep(replicas, cpus, options, cache ? &*cache : nullptr, games, progress);
+	}
+
+	if (options.profile)
+		stop_profiling();
+
+	// A cancelled run only reports the games that finished.
+	const bool cancelled{ cancel_requested() };
+	Dictionary finished_words{};
+	std::vector<unsigned char> finished_games{};
+
+	if (cancelled)
+	{
+		for (std::size_t i{}; i < games.size(); ++i)
+		{
+			if (games[i] == 0) continue;
+
+			finished_words.push_back(dict_a[i]);
+			finished_games.push_back(games[i]);
+		}
+	}
+
+	const Dictionary& words{ cancelled ? finished_words : dict_a };
+	const std::vector<unsigned char>& results{ cancelled ? finished_games : games };
+
+	const Stats stats{ tally(results) };
+
+	const auto end_time{ std::chrono::steady_clock::now() };
+	const std::chrono::duration<double> elapsed_time{ end_time - start_time };
+
+	std::ostringstream notes{};
+	notes << "* Took " << elapsed_time.count() << " seconds." << '\n';
+	notes << "* Made " << guess_count << " distinct guesses for " << dict_a.size() << " games." << '\n';
+
+	// The games are played in lockstep, so the games that finish first are the ones that took the fewest turns.
+	if (cancelled)
+		notes << "* Cancelled after " << results.size() << " of " << dict_a.size() << " games (the unfinished games are left out, so the averages favor the easiest words)." << '\n';
+
+	if (sampled)
+		notes << "* Sampled " << dict_a.size() << " of " << dict_all.size() << " words (Seed: " << random_seed() << ")." << '\n';
+	else if (sharded)
+		notes << "* Shard " << options.shard_index << " of " << options.shard_count << " (" << dict_a.size() << " of " << dict_all.size() << " words)." << '\n';
+
+	if (lookahead)
+		notes << "* Lookahead on the best " << options.lookahead.breadth << " guesses (up to " << options.lookahead.budget << " ms per turn)." << '\n';
+
+	if (sampling)
+		notes << "* Sampled Scoring of the best " << options.sampling.breadth << " exploring guesses (exact up to " << options.sampling.exact_limit << " candidates)." << '\n';
+
+	if (cache)
+	{
+		const PatternCache::Statistics cache_stats{ cache->statistics() };
+		notes << "* Pattern Cache: " << cache_stats.tiles << " of " << cache_stats.capacity << " tiles used (" << format_bytes(cache_stats.bytes) << "), " << (cache_stats.hit_rate() * 100.0) << "% hit rate, "
+			<< cache_stats.evictions << " evictions." << '\n';
+	}
+
+	if (options.placement.enabled())
+		notes << "* Placement: " << describe_placement(replicas, cpus) << '.' << '\n';
+
+	notes << "* Peak Memory: " << describe_memory(memory_ledger().report()) << '.' << '\n';
+
+	// The profile follows the statistics, so it is written to the results file with them.
+	const std::string statstream{ format_stats(name, stats, notes.str(), sampled && !cancelled) + (options.profile ? '\n' + profile_report() : std::string{}) };
+
+	std::cout << '\n' << statstream << '\n';
+
+	if (cancelled)
+	{
+		// Partial results are written as a report (even for a shard, since they cannot be merged), without replacing the full results.
+		const std::string shard{ sharded ? " Shard " + std::to_string(options.shard_index) + " of " + std::to_string(options.shard_count) : "" };
+		write_results(std::string("./Tests/") + name + (lookahead ? " Lookahead" : "") + (sampling ? " Sampling" : "") + (sampled ? " Sample" : "") + shard + " Partial Results.txt",
+			statstream, name, elapsed_time.count(), words, results);
+	}
+	else if (sharded)
+	{
+		// The partial results only hold what merge_results() needs to rebuild the full report.
+		const std::string filename{ shard_filename(name, options.shard_index, options.shard_count) };
+		std::ofstream file{ filename };
+
+		if (!file)
+			throw std::runtime_error("Unable to open output file.");
+
+		std::cout << "Writing partial results to '" << filename << "'...\n";
+
+		file << "dictionary " << name << '\n';
+		file << "shard " << options.shard_index << ' ' << options.shard_count << '\n';
+		file << "words " << dict_all.size() << '\n';
+		file << "seconds " << elapsed_time.count() << '\n';
+		file << "games " << games.size() << '\n';
+
+		for (const auto tries : games)
+			file << unsigned(tries) << '\n';
+
+		std::cout << "Done!\n";
+	}
+	else
+	{
+		write_results(std::string("./Tests/") + name + (lookahead ? " Lookahead" : "") + (sampling ? " Sampling" : "") + (sampled ? " Sample Results.txt" : " Results.txt"), statstream, name, elapsed_time.count(), words, results);
+	}
+
+	std::cout << "\n======================================================================\n\n";
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void scale_ai(const DictType type, const std::size_t word_length, const PlacementOptions& placement)
+{
+	const Dictionary dict_a{ load_answers(type, word_length) };
+	const Dictionary dict_g{ load_guesses(type, word_length) };
+	const std::string name{ dictionary_name(type, word_length) };
+
+	// Without a page mode or replication, the policy that is measured is the full one.
+	PlacementOptions policy{ placement };
+	if (policy.pages == PageMode::Default && !policy.replicate)
+	{
+		policy.pages = PageMode::Transparent;
+		policy.replicate = true;
+	}
+
+	// Runs double the workers up to every CPU (the last run always uses them all).
+	const std::size_t max_threads{ placement.threads != 0 ? placement.threads : cpu_count() };
+	std::vector<std::size_t> thread_counts{};
+	for (std::size_t threads{ 1 }; threads < max_threads; threads *= 2)
+		thread_counts.push_back(threads);
+	thread_counts.push_back(max_threads);
+
+	// A single run, with every game played to the end.
+	struct Run
+	{
+		std::size_t threads;
+		bool policy;
+		double seconds;
+		std::size_t huge_pages;
+		std::string placement;
+		MemoryLedger::Report memory;
+		std::size_t peak_rss;
+	};
+
+	std::cout << "\n========================= WORDLE AI SCALING ==========================\n\n";
+	std::cout << "Playing all " << dict_a.size() << " words in '" << name << "' on 1 to " << max_threads << " workers (" << cpu_count() << " CPUs on "
+		<< numa_nodes().size() << " NUMA nodes), with and without " << page_mode_name(policy.pages) << " pages" << (policy.replicate ? " and a copy per node" : "") << "...\n\n";
+
+	std::cout << " Workers |   Default (s)   Games/s   Speedup |    Policy (s)   Games/s   Speedup\n";
+	std::cout << "---------+-------------------------------------+------------------------------------\n";
+
+	std::vector<Run> runs{};
+	std::vector<unsigned char> reference{};
+	const InterruptScope interrupts{};
+
+	for (const std::size_t threads : thread_counts)
+	{
+		std::ostringstream row{};
+		row << std::fixed << std::setw(8) << threads << " ";
+
+		for (const bool with_policy : { false, true })
+		{
+			TestOptions options{};
+			options.placement = with_policy ? policy : PlacementOptions{};
+			options.placement.threads = threads;
+
+			// The data is placed before the clock starts (it is built once, and then read by every game of a run).
+			const std::vector<std::vector<int>> cpus{ pick_workers(options.placement) };
+			const std::vector<std::unique_ptr<SharedData>> replicas{ place_data(dict_a, dict_g, options.placement, cpus) };
+
+			memory_ledger().reset_peaks();
+			const MemoryCharge dictionaries{ Subsystem::Dictionaries, dictionary_usage({ &dict_a, &dict_g }, replicas) };
+
+			ProgressCounters progress{};
+			std::vector<unsigned char> games(dict_a.size());
+
+			const auto start_time{ std::chrono::steady_clock::now() };
+			play_lockstep(replicas, cpus, options, nullptr, games, progress);
+			const std::chrono::duration<double> elapsed_time{ std::chrono::steady_clock::now() - start_time };
+
+			if (cancel_requested())
+				break;
+
+			// Placement only moves the data, so every run must play exactly the same games.
+			if (reference.empty())
+				reference = games;
+			else if (games != reference)
+				throw std::runtime_error("Placement changed the results of the games.");
+
+			const Run& run{ runs.emplace_back(Run{ threads, with_policy, elapsed_time.count(), huge_page_bytes(), describe_placement(replicas, cpus), memory_ledger().report(), peak_rss() }) };
+			const double speedup{ runs.front().seconds / run.seconds };
+
+			row << "| " << std::setprecision(3) << std::setw(13) << run.seconds << std::setprecision(0) << std::setw(10) << (double(dict_a.size()) / run.seconds)
+				<< std::setprecision(2) << std::setw(9) << speedup << "x ";
+		}
+
+		if (cancel_requested())
+		{
+			std::cout << "\nCancelled (the runs that finished are still written).\n";
+			break;
+		}
+
+		std::cout << row.str() << std::endl;
+	}
+
+	const std::string filename{ std::string("./Tests/") + name + " Scaling.json" };
+	std::ofstream file{ filename };
+	if (!file)
+		throw std::runtime_error("Unable to open output file.");
+
+	if (!runs.empty())
+		std::cout << "\nPeak memory of the last run: " << describe_memory(runs.back().memory) << ".\n";
+
+	std::cout << "\nWriting the measurements to '" << filename << "'...\n";
+
+	file << "{\n";
+	file << "  \"dictionary\": \"" << name << "\",\n";
+	file << "  \"games\": " << dict_a.size() << ",\n";
+	file << "  \"cpus\": " << cpu_count() << ",\n";
+	file << "  \"numa_nodes\": " << numa_nodes().size() << ",\n";
+	file << "  \"policy\": { \"pages\": \"" << page_mode_name(policy.pages) << "\", \"replicate\": " << (policy.replicate ? "true" : "false") << " },\n";
+	file << "  \"memory_budget\": " << memory_ledger().report().budget << ",\n";
+	file << "  \"runs\": [\n";
+
+	for (std::size_t i{}; i < runs.size(); ++i)
+	{
+		const Run& run{ runs[i] };
+		file << "    { \"threads\": " << run.threads << ", \"policy\": " << (run.policy ? "true" : "false") << ", \"placement\": \"" << run.placement
+			<< "\", \"seconds\": " << run.seconds << ", \"games_per_second\": " << (double(dict_a.size()) / run.seconds)
+			<< ", \"speedup\": " << (runs.front().seconds / run.seconds) << ", \"huge_page_bytes\": " << run.huge_pages << ",\n";
+
+		// The peak bytes of each subsystem during the run (the peak RSS is of the whole process, so it never goes down between runs).
+		file << "      \"memory\": { ";
+		for (std::size_t s{}; s < subsystem_count; ++s)
+			file << '"' << subsystem_name(Subsystem(s)) << "\": " << run.memory.peaks[s] << ", ";
+
+		file << "\"peak_total\": " << run.memory.peak_total << ", \"peak_rss\": " << run.peak_rss << " } }" << (i + 1 < runs.size() ? "," : "") << '\n';
+	}
+
+	file << "  ]\n";
+	file << "}\n";
+
+	std::cout << "Done!\n";
+	std::cout << "\n======================================================================\n\n";
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void merge_results(const DictType type, const std::size_t word_length, const std::size_t shards)
+{
+	const Dictionary dict_a{ load_answers(type, word_length) };
+	const std::string name{ dictionary_name(type, word_length) };
+
+	std::cout << "\n========================== WORDLE AI  MERGE ==========================\n\n";
+
+	std::cout << "Merging the shards of '" << name << "'...\n";
+
+	std::vector<unsigned char> games(dict_a.size());
+	std::vector<bool> filled(dict_a.size());
+
+	std::size_t shard_count{ shards };
+	std::size_t shards_found{};
+	double longest_time{};
+	double total_time{};
+
+	// Without a number of shards, it is found from the name of the file of shard 1 (which must then be the only one).
+	if (shard_count == 0)
+	{
+		const std::string prefix{ name + " Shard 1 of " };
+		std::vector<std::string> matches{};
+		for (const auto& entry : std::filesystem::directory_iterator{ "./Tests/" })
+		{
+			const std::string filename{ entry.path().filename().string() };
+			if (filename.compare(0, prefix.size(), prefix) == 0)
+				matches.push_back(filename);
+		}
+
+		if (matches.empty())
+			throw std::runtime_error("No shards were found for the given dictionary.");
+		if (matches.size() > 1)
+			throw std::runtime_error("Shards of more than one test were found for the given dictionary (give the number of shards to merge).");
+
+		std::istringstream count{ matches.front().substr(prefix.size()) };
+		if (!(count >> shard_count) || shard_count == 0)
+			throw std::runtime_error("Shard file does not match the given dictionary: " + matches.front());
+	}
+
+	for (std::size_t shard_index{ 1 }; shard_index <= shard_count; ++shard_index)
+	{
+		const std::string filename{ shard_filename(name, shard_index, shard_count) };
+
+		std::ifstream file{ filename };
+		if (!file)
+			throw std::runtime_error("Missing shard file: " + filename);
+
+		std::string key{};
+		std::string dictionary{};
+		std::size_t index{};
+		std::size_t count{};
+		std::size_t words{};
+		double seconds{};
+		std::size_t game_count{};
+
+		file >> key >> std::ws;
+		std::getline(file, dictionary);
+		file >> key >> index >> count >> key >> words >> key >> seconds >> key >> game_count;
+
+		if (!file || dictionary != name || index != shard_index || words != dict_a.size() || count != shard_count)
+			throw std::runtime_error("Shard file does not match the given dictionary: " + filename);
+
+		++shards_found;
+		longest_time = std::max(longest_time, seconds);
+		total_time += seconds;
+
+		std::size_t i{ index - 1 };
+		for (std::size_t game{}; game < game_count; ++game, i += shard_count)
+		{
+			unsigned tries{};
+			if (!(file >> tries) || i >= games.size() || filled[i])
+				throw std::runtime_error("Shard file is corrupted: " + filename);
+
+			games[i] = static_cast<unsigned char>(tries);
+			filled[i] = true;
+		}
+	}
+
+	if (std::find(filled.begin(), filled.end(), false) != filled.end())
+		throw std::runtime_error("The shards do not cover every word in the dictionary.");
+
+	std::ostringstream notes{};
+	notes << "* Took " << longest_time << " seconds." << '\n';
+	notes << "* Merged " << shards_found << " shards (" << total_time << " seconds in total)." << '\n';
+
+	const std::string statstream{ format_stats(name, tally(games), notes.str(), false) };
+
+	std::cout << '\n' << statstream << '\n';
+
+	write_results(std::string("./Tests/") + name + std::string(" Results.txt"), statstream, name, longest_time, dict_a, games);
+
+	std::cout << "\n======================================================================\n\n";
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+void solve_ai(const DictType type, const std::size_t word_length, const std::size_t breadth)
+{
+	const Dictionary dict_a{ load_answers(type, word_length) };
+	const Dictionary dict_g{ load_guesses(type, word_length) };
+
+	const std::string name{ dictionary_name(type, word_length) };
+
+	Solver::Config config{};
+	config.breadth = breadth;
+	config.checkpoint = std::string("./Tests/") + name + std::string(" Optimal Checkpoint.txt");
 
-	const std::size_t g_size{ std::max({ og_str.size(), wg_str.size(), lg_str.size() }) };
-	const std::size_t r_size{ std::max({ or_str.size(), wr_str.size(), lr_str.size() }) };
-	const std::size_t t_size{ std::max({ ot_str.size(), wt_str.size(), lt_str.size() }) };
+	std::cout << "\n========================== WORDLE AI SOLVER ==========================\n\n";
+
+	if (breadth == 0)
+		std::cout << "Searching every guess for the optimal strategy on '" << name << "'...\n";
+	else
+		std::cout << "Searching the best " << breadth << " guesses at each step for a strategy on '" << name << "'...\n";
+
+	std::cout << "Progress is saved to '" << config.checkpoint << "'.\n";
+
+	const auto start_time{ std::chrono::steady_clock::now() };
+
+	Solver solver{ dict_a, dict_g, config };
+	const Solver::Outcome outcome{ solver.solve() };
+
+	const auto end_time{ std::chrono::steady_clock::now() };
+	const std::chrono::duration<double> elapsed_time{ end_time - start_time };
+
+	const double games{ double(dict_a.size()) };
+
+	std::ostringstream strategy{};
+	const std::size_t most_turns{ solver.write_strategy(strategy) };
 
 	std::ostringstream statstream{};
 	statstream
-		<< "========================== WORDLE AI  STATS ==========================" << '\n'
+		<< "======================= WORDLE AI SOLVER STATS =======================" << '\n'
 		<< '\n'
-		<< dictionary_name(type, word_length) << '\n'
+		<< name << '\n'
 		<< "* Took " << elapsed_time.count() << " seconds." << '\n'
 		<< '\n'
-		<< "Overall:   " << std::setw(g_size) << og_str << "   " << std::setw(r_size) << or_str << "   " << std::setw(t_size) << ot_str << '\n'
-		<< "   Wins:   " << std::setw(g_size) << wg_str << "   " << std::setw(r_size) << wr_str << "   " << std::setw(t_size) << wt_str << '\n'
-		<< " Losses:   " << std::setw(g_size) << lg_str << "   " << std::setw(r_size) << lr_str << "   " << std::setw(t_size) << lt_str << '\n'
+		<< "   First Guess:   " << outcome.guess << '\n'
+		<< "   Total Turns:   " << outcome.total_turns << "   [" << (outcome.total_turns / games) << " Turn Avg.]" << '\n'
+		<< "   Lower Bound:   " << outcome.lower_bound << "   [" << (outcome.lower_bound / games) << " Turn Avg.]" << '\n'
+		<< "    Most Turns:   " << most_turns << '\n'
+		<< "      Strategy:   " << (outcome.exact ? "Optimal" : "Upper Bound") << '\n'
 		<< '\n'
 		<< "======================================================================" << '\n';
 
 	std::cout << '\n' << statstream.str() << '\n';
 
-	const std::string filename{ std::string("./Tests/") + dictionary_name(type, word_length) + std::string(" Results.txt")};
+	const std::string filename{ std::string("./Tests/") + name + std::string(" Optimal Strategy.txt") };
 	std::ofstream file{ filename };
-	
+
 	if (!file)
 	{
 		throw std::runtime_error("Unable to open output file.");
 	}
 	else
 	{
-		std::cout << "Writing results to '" << filename << "'...\n";
-		
-		file << statstream.str() << '\n';
+		std::cout << "Writing strategy to '" << filename << "'...\n";
 
-		file << "\n==== GAME RESULTS ====\n\n";
+		file << statstream.str() << '\n';
 
-		for (std::size_t i{}; i < dict_a.size(); ++i)
-		{
-			const std::string& word{ dict_a[i] };
-			const std::size_t tries{ static_cast<std::size_t>(games[i]) };
-			const bool won{ tries <= 6 };
-		
-			file << word << ": " << tries << " turns  [" << (won ? "WIN" : "LOSE") << "]\n";
-		}
+		file << "\n==== STRATEGY ====\n\n";
+		file << strategy.str();
+		file << "\n==================\n";
 
-		file << "\n======================\n";
-		
 		std::cout << "Done!\n";
 	}
 
@@ -185,8 +1136,49 @@ void test_ai(const DictType type, const std::size_t word_length)
 
 // ================================================================================================================================ //
 
+void list_words(const DictType type, const std::size_t word_length, const std::vector<Results>& feedback)
+{
+	// The loaded words are already sorted, so the rank of each word in the DAWG is its WordID.
+	const Dictionary dict{ load_answers(type) };
+
+	const auto build_time{ std::chrono::steady_clock::now() };
+	const Dawg dawg{ dict };
+	const auto start_time{ std::chrono::steady_clock::now() };
+
+	WordConstraints constraints{ word_length };
+	for (const Results& results : feedback)
+		constraints.add(results);
+
+	const std::vector<WordID> words{ dawg.matching(constraints) };
+	const auto end_time{ std::chrono::steady_clock::now() };
+
+	// Only the first few words are printed, since there can be thousands.
+	constexpr std::size_t max_printed{ 100 };
+
+	std::cout << "\n======================================================================\n\n";
+	std::cout << words.size() << " word(s) of length " << word_length << " match:\n";
+
+	for (std::size_t i{}; i < std::min(words.size(), max_printed); ++i)
+	{
+		std::string word{ dict[words[i]] };
+		make_uppercase(word);
+		std::cout << (i % 10 == 0 ? "\n  " : " ") << word;
+	}
+	if (words.size() > max_printed)
+		std::cout << "\n  ... and " << (words.size() - max_printed) << " more";
+
+	std::cout
+		<< "\n\n* DAWG of " << dict.size() << " words: " << dawg.node_count() << " nodes, " << (dawg.memory_usage() / 1024) << " KB, built in "
+		<< std::chrono::duration<double, std::milli>{ start_time - build_time }.count() << " ms.\n"
+		<< "* Enumeration took " << std::chrono::duration<double, std::milli>{ end_time - start_time }.count() << " ms.\n";
+
+	std::cout << "\n======================================================================\n\n";
+}
+
+// ================================================================================================================================ //
+
 // Prompts the User to enter a Guess until valid input is received.
-std::string read_guess(const Dictionary& dict, const std::size_t length);
+std::string read_guess(const WordSet& words, const std::size_t length);
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
@@ -194,8 +1186,9 @@ void play_sim(const DictType type, const std::size_t suggested_length, const std
 {
 	const std::string word{ !suggested_word.empty() ? std::string(suggested_word) : pick_word(load_answers(type, suggested_length)) };
 	const Dictionary dict_g{ load_guesses(type, word.size()) };
+	const WordSet words{ dict_g };
 
-	WordleSim sim{ pick_word(dict_g, word) };
+	WordleSim sim{ pick_word(words, word) };
 
 	std::cout << "\n==== WORDLE SIM ====\n";
 	std::cout << "\nWord Length is " << sim.word_length() << '\n';
@@ -206,7 +1199,7 @@ void play_sim(const DictType type, const std::size_t suggested_length, const std
 	{
 		std::cout << "\n\n-- Guess " << (sim.tries() + 1) << " --\n";
 
-		const std::string guess{ read_guess(dict_g, sim.word_length()) };
+		const std::string guess{ read_guess(words, sim.word_length()) };
 
 		feedback = sim.make_guess(guess);
 
@@ -219,7 +1212,7 @@ void play_sim(const DictType type, const std::size_t suggested_length, const std
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
-std::string read_guess(const Dictionary& dict, const std::size_t length)
+std::string read_guess(const WordSet& words, const std::size_t length)
 {
 	std::string guess{};
 
@@ -253,7 +1246,7 @@ std::string read_guess(const Dictionary& dict, const std::size_t length)
 		make_lowercase(guess);
 
 		// Check if the Dictionary contains the Guess.
-		if (!std::binary_search(dict.begin(), dict.end(), guess))
+		if (!words.contains(guess))
 		{
 			std::cout << "\nERROR! \"" << guess << "\" could not be found in dictionary.\n";
 			continue;
@@ -289,20 +1282,145 @@ Description: The full Scrabble Dictionary of words of various lengths pulled fro
 
 -- play --
 Description: Has the AI play a single game and prints the full game out to the console.
-Syntax: play <Dictionary> [Word Length or Word]
+Syntax: play <Dictionary> [Word Length or Word] [seed <N>]
 (REQUIRED) <Dictionary>  : One of the two dictionaries listed above.
 (OPTIONAL) [Word Length] : If specified, picks a random word from the dictionary of the specified length.
 (OPTIONAL) [Word]        : If specified, plays the AI against the given word.
+(OPTIONAL) [seed <N>]    : If specified, seeds the random number generator used to pick the word.
 Ex: play Wordle
 Ex: play Scrabble heaps
 
+-- assist --
+Description: Suggests the best guesses for a game that is played elsewhere, from the results that are entered after each guess.
+Syntax: assist <Dictionary> [Word Length] [top <K>]
+(REQUIRED) <Dictionary>  : One of the two dictionaries listed above.
+(OPTIONAL) [Word Length] : The length of the words in the game (required for the Scrabble Dictionary).
+(OPTIONAL) [top <K>]     : The number of guesses to suggest on each turn (10 by default).
+Each guess is entered followed by its results (X = Invalid, - = Exists, O = Correct), Ex: "soare X-O-X".
+Ex: assist Wordle
+Ex: assist Scrabble 7 top 5
+
 -- test --
 Description: Tests the AI against every word in a dictionary and writes the statistics to a file.
-Syntax: test <Dictionary> [Word Length]
-(REQUIRED) <Dictionary>  : One of the two dictionaries listed above.
-(OPTIONAL) [Word Length] : If specified, only tests words of the specified length.
+Syntax: test <Dictionary> [Word Length] [sample <N>] [seed <N>] [shard <I/N>] [lookahead <K>] [budget <MS>] [cache <MB>] [sampling <K>] [profile]
+            [progress <S>] [metrics <File or Port>] [pages <Mode>] [replicate] [threads <N>] [memory <MB>]
+(REQUIRED) <Dictionary>    : One of the two dictionaries listed above.
+(OPTIONAL) [Word Length]   : If specified, only tests words of the specified length.
+(OPTIONAL) [sample <N>]    : If specified, only tests N random words and reports 95% confidence intervals.
+(OPTIONAL) [seed <N>]      : If specified, seeds the random number generator (the same seed picks the same words).
+(OPTIONAL) [shard <I/N>]   : If specified, only tests every Nth word starting at the Ith, and writes partial results for "merge".
+(OPTIONAL) [lookahead <K>] : If specified, searches the best K guesses two turns ahead in the last 3 turns of each game.
+(OPTIONAL) [budget <MS>]   : The longest that the lookahead may search on a single turn (10 ms by default).
+(OPTIONAL) [cache <MB>]    : If specified, the partitions, the sampling and the lookahead read the results of guesses from tiles, using at most MB megabytes.
+(OPTIONAL) [sampling <K>]  : If specified, ranks the best K exploring guesses by how evenly they split the candidates (large sets are sampled).
+(OPTIONAL) [profile]       : If specified, counts the time, cycles, cache misses and branch misses of each phase of the games (Linux only).
+(OPTIONAL) [progress <S>]  : How often a status line is printed while the test runs (every 5 seconds by default, 0 disables it).
+(OPTIONAL) [metrics <T>]   : If specified, also writes the status to a file, or sends it to a UDP port on localhost (if T is a number).
+(OPTIONAL) [pages <Mode>]  : How the dictionaries and index that every game reads are backed: "default", "transparent" huge pages,
+                             or "explicit" huge pages from the reserved pool (Linux only, falls back to transparent if the pool is empty).
+(OPTIONAL) [replicate]     : If specified, copies the shared data to every NUMA node, and plays each node's games on its own copy.
+(OPTIONAL) [threads <N>]   : If specified, plays the games on N workers pinned to their CPUs (filling one NUMA node before the next).
+(OPTIONAL) [memory <MB>]   : If specified, the caches stop growing once the program holds MB megabytes (dictionaries and games included).
+The peak memory of the dictionaries, the game state and the caches, and the peak RSS, are reported with the statistics.
+Press Ctrl-C to stop a test early: the games that finished are written to a "Partial Results" file. Press it again to quit.
 Ex: test Wordle
 Ex: test Scrabble 5
+Ex: test Scrabble sample 1000 seed 42
+Ex: test Scrabble shard 2/8
+Ex: test Scrabble 5 lookahead 20
+Ex: test Scrabble lookahead 20 cache 256
+Ex: test Scrabble 12 sampling 30
+Ex: test Wordle profile
+Ex: test Scrabble progress 1 metrics progress.log
+Ex: test Scrabble pages transparent replicate threads 32
+
+-- scale --
+Description: Measures how the speed of a test scales from 1 worker to every CPU, with and without a placement of the shared data.
+Every run must give the same results. The measurements are written to a "Scaling.json" file.
+Syntax: scale <Dictionary> [Word Length] [pages <Mode>] [replicate] [threads <N>] [memory <MB>]
+(REQUIRED) <Dictionary>   : One of the two dictionaries listed above.
+(OPTIONAL) [Word Length]  : If specified, only tests words of the specified length.
+(OPTIONAL) [pages <Mode>] : The pages of the placement that is measured (as for "test").
+(OPTIONAL) [replicate]    : If specified, the placement that is measured has a copy of the shared data on every NUMA node.
+(OPTIONAL) [threads <N>]  : The most workers to run with (every CPU by default).
+(OPTIONAL) [memory <MB>]  : The memory budget of every run (as for "test"). The peak memory of every run is written with it.
+Without pages or replicate, the placement that is measured is transparent huge pages with a copy on every node.
+Ex: scale Wordle
+Ex: scale Scrabble 5 pages explicit replicate threads 64
+
+-- merge --
+Description: Combines the partial results of a sharded test into the full results file.
+Syntax: merge <Dictionary> [Word Length] [shards <N>]
+(REQUIRED) <Dictionary>  : One of the two dictionaries listed above.
+(OPTIONAL) [Word Length] : Must match the word length that the shards were tested with.
+(OPTIONAL) [shards <N>]  : The number of shards that the test was split into (required if shards of more than one test are in Tests/).
+Ex: merge Scrabble
+Ex: merge Scrabble 5 shards 4
+
+-- solve --
+Description: Searches for the strategy that minimizes the average number of turns and writes it to a file.
+Syntax: solve <Dictionary> [Word Length] [Breadth] [memory <MB>]
+(REQUIRED) <Dictionary>  : One of the two dictionaries listed above.
+(OPTIONAL) [Word Length] : The length of the words to solve (required for the Scrabble Dictionary).
+(OPTIONAL) [Breadth]     : If specified, only searches the best N guesses at each step (faster, but not proven optimal).
+(OPTIONAL) [memory <MB>] : If specified, the search stops caching new sets once the program holds MB megabytes.
+Ex: solve Wordle
+Ex: solve Scrabble 4 50
+
+-- words --
+Description: Lists the words that match the results of the guesses so far, and how long it took to find them.
+Syntax: words <Dictionary> <Word Length> [<Guess> <Results>]...
+(REQUIRED) <Dictionary>  : One of the two dictionaries listed above.
+(REQUIRED) <Word Length> : The length of the words to list.
+(OPTIONAL) [<Guess> <Results>]... : Each guess followed by its results (X = Invalid, - = Exists, O = Correct).
+Ex: words Wordle 5 soare X-O-X
+Ex: words Scrabble 7 planets XX-OXX-
+
+-- compare --
+Description: Compares two test results (a "Results.txt" report or a ".tsv" file) game by game, and reports any regressions.
+Syntax: compare "<Baseline>" "<Candidate>" [turns <T>] [time <P>]
+(REQUIRED) "<Baseline>"  : The results to compare against (files in the Tests folder may be given without the folder).
+                           Several runs of the same test may be given, separated by commas (the games of the first, the time of all).
+(REQUIRED) "<Candidate>" : The results to compare (also one or more runs).
+(OPTIONAL) [turns <T>]   : How much the average number of turns may rise before it is a regression (0 by default).
+(OPTIONAL) [time <P>]    : How many percent slower the run may be before it is a regression (20 by default).
+Changes in turns and wins are only regressions if they are statistically significant. So is a slowdown, when both sides have
+several runs; with single runs, only runs of at least 1 second are judged on time.
+From the command line, "<Program> compare ..." exits with 1 if there is a regression (and 2 on errors).
+Ex: compare "Wordle Dictionary - All Results.txt" "Wordle Dictionary - All Sampling Results.tsv"
+
+-- verify --
+Description: Checks every optimized engine (Feedback, filtering, caches, indices) against the reference engine, and shrinks any mismatch.
+Syntax: verify [sample <N>] [cases <N>] [seed <N>]
+(OPTIONAL) [sample <N>] : The number of Wordle guesses to check against every Wordle answer (200 by default).
+(OPTIONAL) [cases <N>]  : The number of random cases to check for each word length from 2 to 15 (2000 by default).
+(OPTIONAL) [seed <N>]   : Seeds the random guesses and cases (1 by default).
+From the command line, "<Program> verify ..." exits with 1 if any engine does not match.
+Ex: verify
+Ex: verify sample 2000 cases 20000 seed 7
+
+-- embed --
+Description: Writes the built-in dictionaries to "src/EmbeddedDictionaries.inc", so that they can be compiled into the program.
+Rebuild with EMBED_DICTIONARIES defined (e.g. "-D EMBED_DICTIONARIES") to load them without reading any files.
+Syntax: embed
+
+-- serve --
+Description: Runs a server on localhost that keeps the dictionaries loaded and answers requests for the next guess.
+Syntax: serve [Port] [Threads]
+(OPTIONAL) [Port]    : The TCP port to listen on (7878 by default).
+(OPTIONAL) [Threads] : The number of sessions that are handled at the same time.
+Requests (one per line):
+  <Dictionary> <Word Length> [<Guess> <Results>]...  : Replies with the next guess and the number of remaining candidates.
+  stats                                              : Replies with the latency percentiles of the requests so far.
+  shutdown                                           : Stops the server.
+Ex: serve
+Ex: serve 9000 8
+
+-- client --
+Description: Sends a single request to a server on localhost and prints the response.
+Syntax: client <Port> <Request>
+Ex: client 7878 wordle 5 soare X-O-X
+Ex: client 7878 stats
 
 -- quit --
 Description: Terminates the program.
@@ -313,6 +1431,93 @@ Description: Terminates the program.
 
 // -------------------------------------------------------------------------------------------------------------------------------- //
 
+// The port that the server listens on by default.
+inline constexpr std::size_t default_port{ 7878 };
+
+// Names of the options that can be given to commands (each is followed by a value).
+inline constexpr std::string_view option_names[]{ "sample", "seed", "shard", "shards", "lookahead", "budget", "cache", "sampling", "top", "progress", "metrics", "pages", "threads", "memory" };
+
+// Names of the options that are given on their own (without a value).
+inline constexpr std::string_view flag_names[]{ "profile", "replicate" };
+
+// Returns true if the string is made up of only digits.
+static bool is_digits(const std::string_view str)
+{
+	return !str.empty() && std::all_of(str.begin(), str.end(), [](const char chr) { return std::isdigit(chr); });
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Reads the thresholds that follow the two files given to compare (returns false if the arguments are invalid).
+static bool parse_compare(const std::vector<std::string>& args, CompareOptions& options)
+{
+	if (args.size() < 2 || args.size() % 2 != 0)
+		return false;
+
+	for (std::size_t i{ 2 }; i < args.size(); i += 2)
+	{
+		std::istringstream value{ args[i + 1] };
+		double threshold{};
+		if (!(value >> threshold) || !(value >> std::ws).eof() || threshold < 0)
+			return false;
+
+		if (args[i] == "turns")
+			options.turns = threshold;
+		else if (args[i] == "time")
+			options.time_percent = threshold;
+		else
+			return false;
+	}
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Reads the options given to verify (returns false if the arguments are invalid).
+static bool parse_verify(const std::vector<std::string>& args, VerifyOptions& options)
+{
+	if (args.size() % 2 != 0)
+		return false;
+
+	for (std::size_t i{}; i < args.size(); i += 2)
+	{
+		if (!is_digits(args[i + 1]))
+			return false;
+
+		if (args[i] == "sample")
+			options.guesses = std::stoul(args[i + 1]);
+		else if (args[i] == "cases")
+			options.cases_per_length = std::stoul(args[i + 1]);
+		else if (args[i] == "seed")
+			options.seed = std::stoull(args[i + 1]);
+		else
+			return false;
+	}
+	return true;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+int run_command_line(const int argc, const char* const argv[])
+{
+	const std::vector<std::string> args(argv + 1, argv + argc);
+
+	CompareOptions compare_options{};
+	if (!args.empty() && args[0] == "compare" && parse_compare({ args.begin() + 1, args.end() }, compare_options))
+		return compare_runs(args[1], args[2], compare_options) ? 1 : 0;
+
+	VerifyOptions verify_options{};
+	if (!args.empty() && args[0] == "verify" && parse_verify({ args.begin() + 1, args.end() }, verify_options))
+		return verify_engines(verify_options) == 0 ? 0 : 1;
+
+	std::cerr
+		<< "Usage: " << argv[0] << " compare <Baseline> <Candidate> [turns <T>] [time <P>]\n"
+		<< "       " << argv[0] << " verify [sample <N>] [cases <N>] [seed <N>]\n";
+	return 2;
+}
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
 void prompt_user()
 {
 	std::cout << help_message << '\n';
@@ -322,8 +1527,6 @@ void prompt_user()
 		std::string line{};
 		std::string command{};
 		std::string dictionary{};
-		std::string arg{};
-		std::string excess{};
 
 		while (line.empty())
 		{
@@ -334,9 +1537,53 @@ void prompt_user()
 				throw std::runtime_error("Standard Input stream failure.");
 		}
 
+		// Paths are case-sensitive, so the compare command (and the values of options) read the line as it was entered.
+		const std::string raw_line{ line };
+
 		make_lowercase(line);
 		std::istringstream stream{ line };
-		stream >> command >> dictionary >> arg >> excess;
+		stream >> command >> dictionary;
+
+		// Arguments are split into Named Options ("<name> <value>" pairs) and Positional Arguments (everything else).
+		std::vector<std::string> positional{};
+		std::map<std::string, std::string> options{};
+		bool missing_value{ false };
+
+		// The line as it was entered is read in step with the lowercase line, so that values that are paths keep their case.
+		std::istringstream raw_stream{ raw_line };
+		std::map<std::string, std::string> raw_options{};
+		std::string raw_token{};
+		raw_stream >> raw_token >> raw_token;
+
+		for (std::string token{}; stream >> token;)
+		{
+			raw_stream >> raw_token;
+
+			// Options may also be written as "--<name>".
+			if (token.size() > 2 && token.compare(0, 2, "--") == 0)
+				token.erase(0, 2);
+
+			if (std::find(std::begin(option_names), std::end(option_names), token) != std::end(option_names))
+			{
+				std::string value{};
+				missing_value |= !(stream >> value);
+				options[token] = value;
+
+				raw_stream >> raw_token;
+				raw_options[token] = raw_token;
+			}
+			else if (std::find(std::begin(flag_names), std::end(flag_names), token) != std::end(flag_names))
+			{
+				options[token] = "";
+			}
+			else
+			{
+				positional.push_back(token);
+			}
+		}
+
+		const std::string arg{ positional.size() > 0 ? positional[0] : "" };
+		const std::string option{ positional.size() > 1 ? positional[1] : "" };
 
 		if (command.empty())
 		{
@@ -349,7 +1596,148 @@ void prompt_user()
 			std::cout << "\nTerminating Wordle-AI program...\n";
 			return;
 		}
-		else if ((command != "play") && (command != "test"))
+		else if (command == "serve")
+		{
+			// The dictionary argument is the port for this command.
+			const std::string threads{ positional.empty() ? "" : positional[0] };
+			if ((!dictionary.empty() && !is_digits(dictionary)) || (!threads.empty() && !is_digits(threads)) || positional.size() > 1 || !options.empty())
+			{
+				std::cout << "ERROR: Invalid argument specified.\n";
+				continue;
+			}
+
+			const std::size_t port{ dictionary.empty() ? default_port : std::stoul(dictionary) };
+			SolverServer server{ static_cast<std::uint16_t>(port), threads.empty() ? std::max(1u, std::thread::hardware_concurrency()) : std::stoul(threads) };
+			server.run();
+			continue;
+		}
+		else if (command == "client")
+		{
+			// Everything after the port is sent as-is.
+			std::istringstream request_stream{ line };
+			std::string request{};
+			request_stream >> command >> dictionary >> std::ws;
+			std::getline(request_stream, request);
+
+			if (!is_digits(dictionary) || request.empty())
+			{
+				std::cout << "ERROR: A port and a request must be specified.\n";
+				continue;
+			}
+
+			const auto start_time{ std::chrono::steady_clock::now() };
+			const std::string response{ send_request(static_cast<std::uint16_t>(std::stoul(dictionary)), request) };
+			const auto end_time{ std::chrono::steady_clock::now() };
+
+			std::cout << response << "\n(Round trip took " << std::chrono::duration<double, std::milli>{ end_time - start_time }.count() << " ms.)\n";
+			continue;
+		}
+		else if (command == "embed")
+		{
+			if (!dictionary.empty())
+			{
+				std::cout << "ERROR: Too many arguments provided.\n";
+				continue;
+			}
+
+			const std::string filename{ "./src/EmbeddedDictionaries.inc" };
+			std::cout << "Writing the built-in dictionaries to '" << filename << "'...\n";
+			write_embedded(filename);
+			std::cout << "Done! Rebuild with EMBED_DICTIONARIES defined to use them.\n";
+			continue;
+		}
+		else if (command == "verify")
+		{
+			std::istringstream verify_stream{ line };
+			std::vector<std::string> args{};
+			verify_stream >> command;
+			for (std::string token{}; verify_stream >> token;)
+				args.push_back(token);
+
+			VerifyOptions verify_options{};
+			if (!parse_verify(args, verify_options))
+			{
+				std::cout << "ERROR: Invalid option specified.\n";
+				continue;
+			}
+
+			verify_engines(verify_options);
+			continue;
+		}
+		else if (command == "compare")
+		{
+			std::istringstream compare_stream{ raw_line };
+			std::vector<std::string> args{};
+			compare_stream >> command;
+			for (std::string token{}; compare_stream >> std::quoted(token);)
+				args.push_back(token);
+
+			CompareOptions compare_options{};
+			if (!parse_compare(args, compare_options))
+			{
+				std::cout << "ERROR: A baseline and a candidate must be specified (with valid thresholds).\n";
+				continue;
+			}
+
+			compare_runs(args[0], args[1], compare_options);
+			continue;
+		}
+		else if (command == "words")
+		{
+			DictType type{};
+			if (dictionary == "wordle")
+			{
+				type = DictType::Wordle;
+			}
+			else if (dictionary == "scrabble")
+			{
+				type = DictType::Scrabble;
+			}
+			else
+			{
+				std::cout << "ERROR: Invalid dictionary specified.\n";
+				continue;
+			}
+
+			// Results may start with "--", so the arguments are read from the line as-is (rather than split into options).
+			std::istringstream words_stream{ line };
+			std::vector<std::string> args{};
+			words_stream >> command >> dictionary;
+			for (std::string token{}; words_stream >> token;)
+				args.push_back(token);
+
+			if (args.empty() || !is_digits(args[0]) || std::stoul(args[0]) == 0 || args.size() % 2 != 1)
+			{
+				std::cout << "ERROR: A word length must be specified, and every guess must be followed by its results.\n";
+				continue;
+			}
+
+			const std::size_t length{ std::stoul(args[0]) };
+			std::vector<Results> feedback{};
+			bool valid{ true };
+
+			for (std::size_t i{ 1 }; i < args.size() && valid; i += 2)
+			{
+				const std::string& guess{ args[i] };
+				const std::string& text{ args[i + 1] };
+
+				valid = guess.size() == length && std::all_of(guess.begin(), guess.end(), [](const char chr) { return std::islower(chr); }) && text.size() == length
+					&& std::all_of(text.begin(), text.end(), [](const char chr) { return chr == 'x' || chr == '-' || chr == 'o'; });
+
+				if (valid)
+					feedback.push_back(Results::parse(guess, text));
+			}
+
+			if (!valid)
+			{
+				std::cout << "ERROR: Every guess and its results must have " << length << " letters.\n";
+				continue;
+			}
+
+			list_words(type, length, feedback);
+			continue;
+		}
+		else if ((command != "play") && (command != "assist") && (command != "test") && (command != "solve") && (command != "merge") && (command != "scale"))
 		{
 			std::cout << "ERROR: Invalid command specified.\n";
 			continue;
@@ -360,12 +1748,114 @@ void prompt_user()
 			std::cout << "ERROR: No dictionary was specified.\n";
 			continue;
 		}
-		if (!excess.empty())
+		if (positional.size() > (command == "solve" ? 2 : 1))
 		{
 			std::cout << "ERROR: Too many arguments provided.\n";
 			continue;
 		}
 
+		const auto allows = [&](const std::string& name)
+		{
+			return (name == "seed" && (command == "play" || command == "test")) || (name == "top" && command == "assist") || (name == "shards" && command == "merge") || ((name == "sample" || name == "shard" || name == "lookahead" || name == "budget" || name == "cache" || name == "sampling" || name == "profile" || name == "progress" || name == "metrics") && command == "test")
+				|| ((name == "pages" || name == "replicate" || name == "threads") && (command == "test" || command == "scale"))
+				|| (name == "memory" && (command == "test" || command == "scale" || command == "solve"));
+		};
+
+		// The shard is given as "<Index>/<Count>".
+		const std::size_t slash{ options.count("shard") ? options["shard"].find('/') : std::string::npos };
+		const auto is_valid = [&](const std::pair<const std::string, std::string>& opt)
+		{
+			if (opt.first == "profile" || opt.first == "metrics" || opt.first == "replicate") return true;
+			if (opt.first == "pages") return opt.second == "default" || opt.second == "transparent" || opt.second == "explicit";
+			if (opt.first == "threads") return is_digits(opt.second) && std::stoul(opt.second) != 0;
+			if (opt.first != "shard") return is_digits(opt.second);
+			return slash != std::string::npos && is_digits(opt.second.substr(0, slash)) && is_digits(opt.second.substr(slash + 1));
+		};
+
+		if (missing_value || std::any_of(options.begin(), options.end(), [&](const auto& opt) { return !allows(opt.first) || !is_valid(opt); }))
+		{
+			std::cout << "ERROR: Invalid option specified.\n";
+			continue;
+		}
+
+		TestOptions test_options{};
+		if (options.count("sample"))
+		{
+			test_options.sample_size = std::stoul(options["sample"]);
+		}
+		if (options.count("shard"))
+		{
+			test_options.shard_index = std::stoul(options["shard"].substr(0, slash));
+			test_options.shard_count = std::stoul(options["shard"].substr(slash + 1));
+
+			if (test_options.shard_index == 0 || test_options.shard_index > test_options.shard_count || test_options.sample_size != 0)
+			{
+				std::cout << "ERROR: Invalid shard specified (it must be between 1/N and N/N, and cannot be combined with a sample).\n";
+				continue;
+			}
+		}
+		if (options.count("lookahead"))
+		{
+			test_options.lookahead.breadth = std::stoul(options["lookahead"]);
+		}
+		if (options.count("budget"))
+		{
+			test_options.lookahead.budget = std::stod(options["budget"]);
+
+			if (test_options.lookahead.breadth == 0)
+			{
+				std::cout << "ERROR: A budget can only be given with a lookahead.\n";
+				continue;
+			}
+		}
+		if (options.count("sampling"))
+		{
+			test_options.sampling.breadth = std::stoul(options["sampling"]);
+		}
+		if (options.count("cache"))
+		{
+			test_options.cache_budget = std::stoul(options["cache"]) << 20;
+
+			if (test_options.lookahead.breadth == 0 && test_options.sampling.breadth == 0)
+			{
+				std::cout << "ERROR: A cache can only be given with a lookahead or sampling.\n";
+				continue;
+			}
+		}
+		if (options.count("profile"))
+		{
+			test_options.profile = true;
+		}
+		if (options.count("progress"))
+		{
+			test_options.progress.interval = std::stod(options["progress"]);
+		}
+		if (options.count("metrics"))
+		{
+			test_options.progress.metrics = raw_options["metrics"];
+		}
+		if (options.count("pages"))
+		{
+			const std::string& pages{ options["pages"] };
+			test_options.placement.pages = (pages == "transparent") ? PageMode::Transparent : (pages == "explicit") ? PageMode::Explicit : PageMode::Default;
+		}
+		if (options.count("replicate"))
+		{
+			test_options.placement.replicate = true;
+		}
+		if (options.count("threads"))
+		{
+			test_options.placement.threads = std::stoul(options["threads"]);
+		}
+
+		// The budget is global, so it is set (or removed) for every command.
+		memory_ledger().set_budget(options.count("memory") ? std::size_t(std::stoull(options["memory"])) << 20 : 0);
+		if ((test_options.lookahead.breadth != 0 || test_options.sampling.breadth != 0) && test_options.shard_count != 0)
+		{
+			std::cout << "ERROR: A lookahead or sampling cannot be combined with a shard.\n";
+			continue;
+		}
+
 		DictType type{};
 		if (dictionary == "wordle")
 		{
@@ -381,7 +1871,7 @@ void prompt_user()
 			continue;
 		}
 
-		const bool is_number{ !arg.empty() && std::all_of(arg.begin(), arg.end(), [](const char chr) { return std::isdigit(chr); }) };
+		const bool is_number{ is_digits(arg) };
 		const bool is_word{ !arg.empty() && std::all_of(arg.begin(), arg.end(), [](const char chr) { return std::isalpha(chr); }) };
 		if (!arg.empty() && !is_number && !is_word)
 		{
@@ -397,6 +1887,9 @@ void prompt_user()
 			continue;
 		}
 
+		// Without a seed, every run draws a new one (which re-seeds the generators), so that the seed it prints always reproduces it.
+		set_random_seed(options.count("seed") ? std::stoull(options["seed"]) : std::uint64_t(std::random_device{}()));
+
 		if (command == "play")
 		{
 			const std::string word{ is_word ? arg : "" };
@@ -407,9 +1900,58 @@ void prompt_user()
 			}
 			play_ai(type, length, word);
 		}
+		else if (command == "assist")
+		{
+			const std::size_t top{ options.count("top") ? std::stoul(options["top"]) : 10 };
+			if (is_word || top == 0)
+			{
+				std::cout << "ERROR: Invalid argument specified.\n";
+				continue;
+			}
+			if (type == DictType::Scrabble && !is_number)
+			{
+				std::cout << "ERROR: A word length must be specified to use the assistant with the Scrabble dictionary.\n";
+				continue;
+			}
+			assist_ai(type, is_number ? length : default_length, top);
+		}
 		else if (command == "test")
 		{
-			test_ai(type, length);
+			test_ai(type, length, test_options);
+		}
+		else if (command == "scale")
+		{
+			if (is_word)
+			{
+				std::cout << "ERROR: Invalid argument specified.\n";
+				continue;
+			}
+			scale_ai(type, length, test_options.placement);
+		}
+		else if (command == "merge")
+		{
+			const std::size_t shards{ options.count("shards") ? std::stoul(options["shards"]) : 0 };
+			if (is_word || (options.count("shards") && shards == 0))
+			{
+				std::cout << "ERROR: Invalid argument specified.\n";
+				continue;
+			}
+			merge_results(type, length, shards);
+		}
+		else if (command == "solve")
+		{
+			const bool is_breadth{ is_digits(option) };
+			if (is_word || (!option.empty() && !is_breadth))
+			{
+				std::cout << "ERROR: Invalid argument specified.\n";
+				continue;
+			}
+			if (type == DictType::Scrabble && !is_number)
+			{
+				std::cout << "ERROR: A word length must be specified to solve the Scrabble dictionary.\n";
+				continue;
+			}
+			solve_ai(type, length, is_breadth ? std::stoul(option) : 0);
 		}
 	}
 }
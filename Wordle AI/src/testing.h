@@ -1,7 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
+#include <cmath>
+#include <utility>
+#include <vector>
 #include <string>
 #include <string_view>
 
@@ -11,14 +15,62 @@
 
 #include "WordleSim.h"
 #include "WordleAI.h"
+#include "Progress.h"
+#include "Placement.h"
 
 // ================================================================================================================================ //
 
 // Launches a Console Game version of Wordle for the AI to Play.
 void play_ai(const DictType type = default_dictionary, const std::size_t suggested_length = default_length, const std::string_view suggested_word = "");
 
+// Suggests the best guesses for a game that is played elsewhere, from the Results that the user enters after each guess.
+void assist_ai(const DictType type = default_dictionary, const std::size_t word_length = default_length, const std::size_t count = 10);
+
+// Options that change which words test_ai() tests.
+struct TestOptions
+{
+	// If not 0, only tests this many random words (and reports confidence intervals).
+	std::size_t sample_size{};
+
+	// If shard_count is not 0, only tests every Nth word (starting at word number shard_index, from 1 to N), and writes partial results.
+	std::size_t shard_index{};
+	std::size_t shard_count{};
+
+	// Settings for the AI's Lookahead (disabled by default).
+	Lookahead lookahead{};
+
+	// Settings for the AI's Sampled Scoring (disabled by default).
+	Sampling sampling{};
+
+	// If not 0, the Lookahead reads Patterns from a cache of at most this many bytes.
+	std::size_t cache_budget{};
+
+	// If true, the cost of each phase of the games is profiled (with hardware counters where available) and added to the results.
+	bool profile{};
+
+	// Settings for the status line that is printed while the games are played (and for exporting it).
+	ProgressOptions progress{};
+
+	// Where the dictionaries and the index that every game reads are placed, and which CPUs the games are played on.
+	PlacementOptions placement{};
+};
+
 // Tests the AI on every word of the given length in the specified dictionary.
-void test_ai(const DictType type = default_dictionary, const std::size_t word_length = default_length);
+void test_ai(const DictType type = default_dictionary, const std::size_t word_length = default_length, const TestOptions& options = {});
+
+// Measures how the speed of a test scales from one worker to every CPU (or to the given number of threads), with and without the
+// given placement of the shared data (huge pages and a copy per NUMA node if none is given), and writes the measurements to a JSON file.
+void scale_ai(const DictType type = default_dictionary, const std::size_t word_length = default_length, const PlacementOptions& placement = {});
+
+// Combines the partial results of every shard of a test into the full results file.
+// Without the number of shards, it is read from the only file of shard 1 (and more than one of them throws).
+void merge_results(const DictType type = default_dictionary, const std::size_t word_length = default_length, const std::size_t shards = 0);
+
+// Searches for the optimal strategy for the given dictionary and writes it to a file (a breadth of 0 searches every guess).
+void solve_ai(const DictType type = default_dictionary, const std::size_t word_length = default_length, const std::size_t breadth = 0);
+
+// Prints the words of the given length that match the Results of every guess so far (found by walking a DAWG of the dictionary).
+void list_words(const DictType type, const std::size_t word_length, const std::vector<Results>& feedback);
 
 // Launches a Console Game version of Wordle for the User to Play.
 void play_sim(const DictType type = default_dictionary, const std::size_t suggested_length = default_length, const std::string_view suggested_word = "");
@@ -28,6 +80,9 @@ void play_sim(const DictType type = default_dictionary, const std::size_t sugges
 // Displays a Help Message and allows the user to select how they want to run the AI.
 void prompt_user();
 
+// Runs a single command given on the command line ("compare" or "verify") and returns the exit code.
+int run_command_line(const int argc, const char* const argv[]);
+
 // ================================================================================================================================ //
 
 /*
@@ -41,6 +96,7 @@ public: // Variables
 	std::uintmax_t losses;
 	std::uintmax_t win_turns;
 	std::uintmax_t loss_turns;
+	std::uintmax_t squared_turns;
 
 public: // Functions
 
@@ -48,12 +104,14 @@ public: // Functions
 	{
 		++wins;
 		win_turns += turns;
+		squared_turns += turns * turns;
 	}
 
 	constexpr void add_loss(const std::uintmax_t turns) noexcept
 	{
 		++losses;
 		loss_turns += turns;
+		squared_turns += turns * turns;
 	}
 
 	template <typename T>
@@ -99,6 +157,39 @@ public: // Getters
 		return divide(loss_turns, losses);
 	}
 
+public: // Confidence Intervals (95%, for when the games are a random sample of the dictionary)
+
+	// Returns the sample standard deviation of the number of turns.
+	double turns_stddev() const noexcept
+	{
+		const double n{ double(total_games()) };
+		if (n < 2) return 0.0;
+
+		const double mean{ average_turns() };
+		return std::sqrt(std::max(0.0, (double(squared_turns) - n * mean * mean) / (n - 1)));
+	}
+
+	// Returns the margin of error of the average number of turns.
+	double average_turns_margin() const noexcept
+	{
+		return 1.96 * divide(turns_stddev(), std::sqrt(double(total_games())));
+	}
+
+	// Returns the lower and upper bound of the win ratio (as percentages), using the Wilson score interval.
+	std::pair<double, double> win_ratio_interval() const noexcept
+	{
+		constexpr double z{ 1.96 };
+
+		const double n{ double(total_games()) };
+		if (n == 0) return { 0.0, 0.0 };
+
+		const double p{ double(wins) / n };
+		const double center{ (p + z * z / (2 * n)) / (1 + z * z / n) };
+		const double margin{ (z / (1 + z * z / n)) * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n)) };
+
+		return { 100.0 * std::max(0.0, center - margin), 100.0 * std::min(1.0, center + margin) };
+	}
+
 };
 
 // ================================================================================================================================ //
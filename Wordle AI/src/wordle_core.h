@@ -0,0 +1,124 @@
+#pragma once
+
+/*
+	The C interface of the Wordle Solver Core (a thin wrapper of WordleCore.h, for callers that are not written in C++).
+
+	No function prints anything, and none of them throws: every error is returned as a wordle_status.
+	Words are copied once, when a solver is created. After that, the guesses and results are read from the caller's memory
+	(they do not need to be null-terminated), and output is written into buffers that the caller provides.
+	Updating a game and making a guess never allocate memory, so a game can be played (and reset) any number of times.
+
+	Words are UTF-8, in any case. A dictionary may use letters past ASCII (such as é, ß or ж): they make up its alphabet, and every
+	length is counted in letters rather than bytes.
+
+	A solver is read-only once it is created, and can be shared by any number of games on any number of threads.
+	A game must only be used by one thread at a time.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ================================================================================================================================ //
+
+// Symbols are exported from (or imported from) a DLL on Windows when the library is built as one (with WORDLE_CORE_SHARED defined).
+#if defined(_WIN32) && defined(WORDLE_CORE_SHARED)
+#  ifdef WORDLE_CORE_EXPORTS
+#    define WORDLE_CORE_API __declspec(dllexport)
+#  else
+#    define WORDLE_CORE_API __declspec(dllimport)
+#  endif
+#elif defined(__GNUC__)
+#  define WORDLE_CORE_API __attribute__((visibility("default")))
+#else
+#  define WORDLE_CORE_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ================================================================================================================================ //
+
+// The result of a call (the same values as CoreStatus).
+typedef enum wordle_status
+{
+	WORDLE_OK = 0,
+	WORDLE_INVALID_ARGUMENT,  // A pointer was null, or a length did not match the length of the words.
+	WORDLE_INVALID_WORD,      // The guess is not in the solver's dictionary (or a word has a character that is not a letter).
+	WORDLE_INVALID_RESULTS,   // The results are not made up of 'X', '-' and 'O' (or the pattern is out of range).
+	WORDLE_NO_CANDIDATES,     // No word matches the results of every guess so far (the game is left as it was).
+	WORDLE_BUFFER_TOO_SMALL,  // The output buffer cannot hold the word and its null terminator.
+	WORDLE_OUT_OF_MEMORY,     // Memory could not be allocated (only when creating a solver or a game).
+	WORDLE_ERROR              // Any other error (e.g. the dictionary could not be read).
+} wordle_status;
+
+// The words and indices that games are played with.
+typedef struct wordle_solver wordle_solver;
+
+// The state of a single game.
+typedef struct wordle_game wordle_game;
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Returns a description of the status (a static string).
+WORDLE_CORE_API const char* wordle_status_message(wordle_status status);
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Creates a solver from the words of the given length in the text (size bytes of words separated by whitespace).
+WORDLE_CORE_API wordle_status wordle_solver_create(const char* words, size_t size, size_t word_length, wordle_solver** solver);
+
+// Creates a solver from the words of the given length in a dictionary file (or the embedded copy of it, if the library has one).
+WORDLE_CORE_API wordle_status wordle_solver_load(const char* filename, size_t word_length, wordle_solver** solver);
+
+// Destroys a solver (every game that uses it must be destroyed first). Does nothing if the solver is null.
+WORDLE_CORE_API void wordle_solver_destroy(wordle_solver* solver);
+
+// Returns the number of words in the solver's dictionary.
+WORDLE_CORE_API size_t wordle_solver_word_count(const wordle_solver* solver);
+
+// Returns the length of the words in the solver's dictionary.
+WORDLE_CORE_API size_t wordle_solver_word_length(const wordle_solver* solver);
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Creates a new game that is played with the words of the solver.
+WORDLE_CORE_API wordle_status wordle_game_create(const wordle_solver* solver, wordle_game** game);
+
+// Destroys a game. Does nothing if the game is null.
+WORDLE_CORE_API void wordle_game_destroy(wordle_game* game);
+
+// Starts the game over.
+WORDLE_CORE_API void wordle_game_reset(wordle_game* game);
+
+// Removes the candidates that do not match the results of the guess (the guess is length letters, and the results are length "X-O" characters).
+WORDLE_CORE_API wordle_status wordle_game_update(wordle_game* game, const char* guess, const char* results, size_t length);
+
+// Removes the candidates that do not match the pattern of the guess (length letters), which has one base-3 digit per letter (the first letter
+// being the lowest digit).
+WORDLE_CORE_API wordle_status wordle_game_update_pattern(wordle_game* game, const char* guess, size_t length, uint32_t pattern);
+
+// Writes the AI's next guess into the buffer as UTF-8 (followed by a null terminator). Up to 4 bytes per letter may be needed.
+WORDLE_CORE_API wordle_status wordle_game_guess(wordle_game* game, char* guess, size_t capacity);
+
+// Returns the number of words that could still be the answer.
+WORDLE_CORE_API size_t wordle_game_candidates(const wordle_game* game);
+
+// Returns the number of guesses made so far.
+WORDLE_CORE_API size_t wordle_game_turn(const wordle_game* game);
+
+// -------------------------------------------------------------------------------------------------------------------------------- //
+
+// Writes the pattern of the guess against the answer (both length letters, which need not be in any dictionary).
+WORDLE_CORE_API wordle_status wordle_pattern(const char* guess, const char* answer, size_t length, uint32_t* pattern);
+
+// Writes the results of the guess against the answer (both length letters) into the buffer as "X-O" text (followed by a null terminator).
+WORDLE_CORE_API wordle_status wordle_feedback(const char* guess, const char* answer, size_t length, char* results, size_t capacity);
+
+// ================================================================================================================================ //
+
+#ifdef __cplusplus
+}
+#endif
+
+// ================================================================================================================================ //